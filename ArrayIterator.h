@@ -11,6 +11,7 @@
 
 #include "Iterator.h"
 #include "IArray.h"
+#include "SimdKernels.h"
 
 
 namespace SimpleDataStructures
@@ -85,6 +86,21 @@ namespace SimpleDataStructures
         }
 
 
+        /**
+         * @brief Skip elements until the one equal to the value
+         * (it will be returned by the next call of next()).
+         * Search is vectorized for arithmetic types (see SimdKernels::find()).
+         * @return false if there is no such element (iterator is at the end).
+         */
+        bool advanceTo(const T& value)
+        {
+            size_t index = SimdKernels::find(nextElement, remainingElements, value);
+            nextElement += index;
+            remainingElements -= index;
+            return remainingElements != 0;
+        }
+
+
         void reset()
         {
             remainingElements = 0;
@@ -0,0 +1,25 @@
+/**
+ * @file CacheLine.h
+ * @author Jan Wielgus
+ * @brief Cache line size used to separate data written by different threads
+ * (avoids false sharing in concurrent data structures).
+ * @date 2026-10-17
+ * 
+ */
+
+#ifndef CACHELINE_H
+#define CACHELINE_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+
+
+namespace SimpleDataStructures
+{
+    // std::hardware_destructive_interference_size is not available in every compiler
+    const size_t CacheLineSize = 64;
+}
+
+
+#endif
@@ -0,0 +1,591 @@
+/**
+ * @file DoublyLinkedList.h
+ * @author Jan Wielgus
+ * @brief Two-way, dynamically allocated linked list class.
+ * Removing from both ends and through the iterator is O(1).
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef DOUBLYLINKEDLIST_H
+#define DOUBLYLINKEDLIST_H
+
+#include "IList.h"
+#include "NodeAllocators.h"
+#include <type_traits>
+#include <utility>
+
+
+namespace SimpleDataStructures
+{
+    template <class T>
+    class DoublyLinkedNode
+    {
+    public:
+        T data;
+        DoublyLinkedNode<T>* prev;
+        DoublyLinkedNode<T>* next;
+
+        DoublyLinkedNode()
+            : prev(nullptr), next(nullptr)
+        {
+        }
+
+        /**
+         * @brief Construct data in place from the args.
+         */
+        template <class... Args>
+        explicit DoublyLinkedNode(DoublyLinkedNode<T>* _prev, DoublyLinkedNode<T>* _next, Args&&... args)
+            : data(std::forward<Args>(args)...), prev(_prev), next(_next)
+        {
+        }
+    };
+
+
+
+    template <class T, class NodeAllocator = HeapNodeAllocator<DoublyLinkedNode<T>>>
+    class DoublyLinkedList;
+
+
+
+    /**
+     * @brief Iterator only for the DoublyLinkedList.
+     * Both next() and remove() are O(1).
+     */
+    template <class T, class NodeAllocator = HeapNodeAllocator<DoublyLinkedNode<T>>>
+    class DoublyLinkedListIterator : public RemovingIterator<T>
+    {
+        DoublyLinkedList<T, NodeAllocator>* list = nullptr;
+        DoublyLinkedNode<T>* nextNode = nullptr;
+        DoublyLinkedNode<T>* lastReturnedNode = nullptr;
+        size_t nextIndex = 0;
+        T nullElement;
+
+    public:
+        DoublyLinkedListIterator(DoublyLinkedList<T, NodeAllocator>& list)
+        {
+            reset(list);
+        }
+
+        DoublyLinkedListIterator(const DoublyLinkedListIterator&) = delete;
+        DoublyLinkedListIterator& operator=(const DoublyLinkedListIterator&) = delete;
+
+
+        DoublyLinkedListIterator(DoublyLinkedListIterator&& toMove)
+        {
+            *this = std::move(toMove);
+        }
+
+
+        DoublyLinkedListIterator& operator=(DoublyLinkedListIterator&& toMove)
+        {
+            if (this != &toMove)
+            {
+                list = toMove.list;
+                nextNode = toMove.nextNode;
+                lastReturnedNode = toMove.lastReturnedNode;
+                nextIndex = toMove.nextIndex;
+
+                toMove.reset();
+            }
+
+            return *this;
+        }
+
+
+        bool hasNext() override
+        {
+            return nextNode != nullptr;
+        }
+
+
+        T& next() override
+        {
+            if (nextNode == nullptr)
+                return nullElement;
+
+            lastReturnedNode = nextNode;
+            nextNode = nextNode->next;
+            nextIndex++;
+            return lastReturnedNode->data;
+        }
+
+
+        /**
+         * @brief Removes the last element returned by next() in O(1) time.
+         */
+        bool remove() override
+        {
+            if (list == nullptr || lastReturnedNode == nullptr)
+                return false;
+
+            nextIndex--;
+            list->removeNode(lastReturnedNode, nextIndex);
+            lastReturnedNode = nullptr;
+            return true;
+        }
+
+
+        /**
+         * @brief Iterator won't have next elements from now.
+         */
+        void reset()
+        {
+            list = nullptr;
+            nextNode = nullptr;
+            lastReturnedNode = nullptr;
+            nextIndex = 0;
+        }
+
+
+        /**
+         * @brief Sets iterator at the beginning of the passed list.
+         */
+        void reset(DoublyLinkedList<T, NodeAllocator>& list)
+        {
+            this->list = &list;
+            nextNode = list.root;
+            lastReturnedNode = nullptr;
+            nextIndex = 0;
+        }
+    };
+
+
+
+
+    /**
+     * @brief Two-way linked list.
+     * Access by index starts from the nearest of: first node, last node
+     * or recently accessed node, so iterating forward or backward by index is O(1) per step.
+     * @tparam T Type of stored elements.
+     * @tparam NodeAllocator Allocator of DoublyLinkedNode<T> objects (see NodeAllocators.h).
+     */
+    template <class T, class NodeAllocator>
+    class DoublyLinkedList : public IList<T>
+    {
+        NodeAllocator nodeAllocator;
+
+        DoublyLinkedNode<T>* root = nullptr;
+        DoublyLinkedNode<T>* tail = nullptr;
+        size_t listSize = 0;
+
+        DoublyLinkedNode<T>* cachedNode = nullptr;
+        size_t cachedNodeIndex = 0;
+
+        T nullElement; // element returned for example when used get() on empty list
+
+        friend class DoublyLinkedListIterator<T, NodeAllocator>;
+
+
+    public:
+        DoublyLinkedList() {}
+
+
+        DoublyLinkedList(const DoublyLinkedList& other)
+        {
+            setFrom(other);
+        }
+
+
+        DoublyLinkedList(DoublyLinkedList&& toMove)
+        {
+            takeNodesFrom(toMove);
+        }
+
+
+        ~DoublyLinkedList()
+        {
+            clear();
+        }
+
+
+        DoublyLinkedList& operator=(const DoublyLinkedList& other)
+        {
+            if (this != &other)
+                setFrom(other);
+
+            return *this;
+        }
+
+
+        DoublyLinkedList& operator=(DoublyLinkedList&& toMove)
+        {
+            if (this != &toMove)
+            {
+                clear();
+                takeNodesFrom(toMove);
+            }
+
+            return *this;
+        }
+
+
+        bool add(const T& item) override
+        {
+            return emplace(item);
+        }
+
+
+        bool add(T&& item) override
+        {
+            return emplace(std::move(item));
+        }
+
+
+        bool add(const T& item, size_t index) override
+        {
+            return emplaceAt(index, item);
+        }
+
+
+        bool add(T&& item, size_t index) override
+        {
+            return emplaceAt(index, std::move(item));
+        }
+
+
+        /**
+         * @brief Construct new item directly inside a new node at the end of the list.
+         * @param args Arguments passed to the T constructor.
+         * @return false if node allocator has run out of memory.
+         */
+        template <class... Args>
+        bool emplace(Args&&... args)
+        {
+            DoublyLinkedNode<T>* newNode = nodeAllocator.create(tail, nullptr, std::forward<Args>(args)...);
+            if (newNode == nullptr)
+                return false;
+
+            if (root == nullptr)
+                root = newNode;
+            else
+                tail->next = newNode;
+
+            tail = newNode;
+            listSize++;
+
+            return true;
+        }
+
+
+        /**
+         * @brief Construct new item directly inside a new node at the specified index.
+         * @param index Index where to construct new item.
+         * @param args Arguments passed to the T constructor.
+         * @return false if index is out of bounds or node allocator has run out of memory.
+         */
+        template <class... Args>
+        bool emplaceAt(size_t index, Args&&... args)
+        {
+            if (index > listSize)
+                return false;
+
+            if (index == listSize)
+                return emplace(std::forward<Args>(args)...);
+
+            DoublyLinkedNode<T>* following = getNode(index);
+            DoublyLinkedNode<T>* newNode = nodeAllocator.create(following->prev, following, std::forward<Args>(args)...);
+            if (newNode == nullptr)
+                return false;
+
+            if (following->prev == nullptr)
+                root = newNode;
+            else
+                following->prev->next = newNode;
+
+            following->prev = newNode;
+            listSize++;
+
+            // cached node (following) was moved one place forward
+            cachedNodeIndex++;
+
+            return true;
+        }
+
+
+        /**
+         * @brief Remove element at specified index.
+         * Removing the first and the last element is O(1),
+         * other indexes are reached from the nearest known node.
+         * @param index Index of element to be removed from the list.
+         * @return true if element was removed. Return false if list is empty
+         * or index is out of bounds.
+         */
+        bool remove(size_t index) override
+        {
+            DoublyLinkedNode<T>* toRemove = getNode(index);
+            if (toRemove == nullptr)
+                return false;
+
+            removeNode(toRemove, index);
+            return true;
+        }
+
+
+        T& get(size_t index) override
+        {
+            DoublyLinkedNode<T>* toReturn = getNode(index);
+            return toReturn == nullptr ? nullElement : toReturn->data;
+        }
+
+
+        const T& get(size_t index) const override
+        {
+            DoublyLinkedNode<T>* toReturn = getNode(index);
+            return toReturn == nullptr ? nullElement : toReturn->data;
+        }
+
+
+        T& operator[](size_t index) override
+        {
+            DoublyLinkedNode<T>* toReturn = getNode(index);
+            return toReturn == nullptr ? nullElement : toReturn->data;
+        }
+
+
+        const T& operator[](size_t index) const override
+        {
+            DoublyLinkedNode<T>* toReturn = getNode(index);
+            return toReturn == nullptr ? nullElement : toReturn->data;
+        }
+
+
+        bool replace(const T& newItem, size_t index) override
+        {
+            DoublyLinkedNode<T>* toReplace = getNode(index);
+
+            if (toReplace == nullptr)
+                return false;
+
+            toReplace->data = newItem;
+            return true;
+        }
+
+
+        bool replace(T&& newItem, size_t index) override
+        {
+            DoublyLinkedNode<T>* toReplace = getNode(index);
+
+            if (toReplace == nullptr)
+                return false;
+
+            toReplace->data = std::move(newItem);
+            return true;
+        }
+
+
+        size_t find(const T& itemToFind, size_t startIndex = 0) const override
+        {
+            size_t elemIndex = startIndex;
+            for (DoublyLinkedNode<T>* node = getNode(startIndex); node != nullptr; node = node->next)
+            {
+                if (node->data == itemToFind)
+                    return elemIndex;
+
+                elemIndex++;
+            }
+
+            return npos;
+        }
+
+
+        bool contains(const T& itemToFind) const override
+        {
+            for (DoublyLinkedNode<T>* node = root; node != nullptr; node = node->next)
+                if (node->data == itemToFind)
+                    return true;
+
+            return false;
+        }
+
+
+        size_t size() const override
+        {
+            return listSize;
+        }
+
+
+        bool isEmpty() const override
+        {
+            return root == nullptr;
+        }
+
+
+        void clear() override
+        {
+            DoublyLinkedNode<T>* nodeToDel = root;
+            while (nodeToDel != nullptr)
+            {
+                DoublyLinkedNode<T>* next = nodeToDel->next;
+                nodeAllocator.destroy(nodeToDel);
+                nodeToDel = next;
+            }
+
+            root = nullptr;
+            tail = nullptr;
+            listSize = 0;
+            cachedNode = nullptr;
+        }
+
+
+        /**
+         * @brief Gives access to the node allocator,
+         * for example to preallocate nodes of the PoolNodeAllocator.
+         */
+        NodeAllocator& getNodeAllocator()
+        {
+            return nodeAllocator;
+        }
+
+
+
+    private:
+        /**
+         * @brief Return node at the index, starting from the nearest
+         * of the root, tail or cached node. Found node is cached.
+         */
+        DoublyLinkedNode<T>* getNode(size_t index) const
+        {
+            if (index >= listSize)
+                return nullptr;
+
+            DoublyLinkedNode<T>* node = root;
+            size_t i = 0;
+            size_t distance = index;
+
+            if (listSize - 1 - index < distance)
+            {
+                node = tail;
+                i = listSize - 1;
+                distance = listSize - 1 - index;
+            }
+
+            if (cachedNode != nullptr)
+            {
+                size_t cachedDistance = cachedNodeIndex < index ? index - cachedNodeIndex : cachedNodeIndex - index;
+                if (cachedDistance < distance)
+                {
+                    node = cachedNode;
+                    i = cachedNodeIndex;
+                }
+            }
+
+            while (i < index)
+            {
+                node = node->next;
+                i++;
+            }
+
+            while (i > index)
+            {
+                node = node->prev;
+                i--;
+            }
+
+            // Store new cached node
+            const_cast<DoublyLinkedList*>(this)->cachedNode = node;
+            const_cast<DoublyLinkedList*>(this)->cachedNodeIndex = index;
+
+            return node;
+        }
+
+
+        /**
+         * @brief Unlink and destroy the node in O(1) time.
+         * @param nodeToRemove Node of this list.
+         * @param index Index of the nodeToRemove (used to keep the cache valid).
+         */
+        void removeNode(DoublyLinkedNode<T>* nodeToRemove, size_t index)
+        {
+            if (nodeToRemove->prev == nullptr)
+                root = nodeToRemove->next;
+            else
+                nodeToRemove->prev->next = nodeToRemove->next;
+
+            if (nodeToRemove->next == nullptr)
+                tail = nodeToRemove->prev;
+            else
+                nodeToRemove->next->prev = nodeToRemove->prev;
+
+            if (cachedNode == nodeToRemove)
+                cachedNode = nullptr;
+            else if (cachedNodeIndex > index)
+                cachedNodeIndex--;
+
+            nodeAllocator.destroy(nodeToRemove);
+            listSize--;
+        }
+
+
+        /**
+         * @brief Clear the list and make a deep copy of data from other.
+         * Existing nodes are reused. If node allocator run out of memory,
+         * only the beginning of other list is copied.
+         * @param other DoublyLinkedList to make a deep copy.
+         */
+        void setFrom(const DoublyLinkedList& other)
+        {
+            DoublyLinkedNode<T>* srcNode = other.root;
+            DoublyLinkedNode<T>* destNode = root;
+            size_t copiedElements = 0;
+
+            // overwrite existing nodes
+            while (srcNode != nullptr && destNode != nullptr)
+            {
+                destNode->data = srcNode->data;
+                srcNode = srcNode->next;
+                destNode = destNode->next;
+                copiedElements++;
+            }
+
+            // delete remaining nodes if this list was bigger than copied one
+            while (listSize > copiedElements)
+                removeNode(tail, listSize - 1);
+
+            // add missing nodes
+            while (srcNode != nullptr && emplace(srcNode->data))
+                srcNode = srcNode->next;
+
+            cachedNode = nullptr;
+        }
+
+
+        /**
+         * @brief Move all elements from the other (this list have to be empty).
+         * If nodes can be transferred between allocators, only pointers are taken,
+         * otherwise elements are moved one by one to the new nodes.
+         * @param toMove DoublyLinkedList to take elements from. Will be empty after that.
+         */
+        void takeNodesFrom(DoublyLinkedList& toMove)
+        {
+            takeNodesFrom(toMove, std::integral_constant<bool, NodeAllocator::CanTransferNodes>());
+        }
+
+
+        void takeNodesFrom(DoublyLinkedList& toMove, std::true_type /* canTransferNodes */)
+        {
+            nodeAllocator.swap(toMove.nodeAllocator);
+
+            root = toMove.root;
+            tail = toMove.tail;
+            listSize = toMove.listSize;
+
+            toMove.root = nullptr;
+            toMove.tail = nullptr;
+            toMove.listSize = 0;
+            toMove.cachedNode = nullptr;
+        }
+
+
+        void takeNodesFrom(DoublyLinkedList& toMove, std::false_type /* canTransferNodes */)
+        {
+            for (DoublyLinkedNode<T>* node = toMove.root; node != nullptr; node = node->next)
+                emplace(std::move(node->data));
+
+            toMove.clear();
+        }
+    };
+}
+
+
+#endif
@@ -0,0 +1,183 @@
+/**
+ * @file FirFilter.h
+ * @author Jan Wielgus
+ * @brief Finite impulse response filter (and moving average) over the last samples.
+ * Samples are kept in a double-written ring buffer, so the window is always
+ * contiguous and the convolution is a single vectorized dot product.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef FIRFILTER_H
+#define FIRFILTER_H
+
+#include "SimdKernels.h"
+#include "Span.h"
+#include <type_traits>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief FIR filter: output = sum of coefficients[k] * sample[n - k],
+     * where sample[n] is the newest sample. Works like a sinking queue
+     * of the last WindowSize samples (that are 0 at the beginning).
+     * Every sample is written twice (at index and index + WindowSize),
+     * so the window starts at any index of the buffer and never wraps.
+     * @tparam T Arithmetic type of samples (float uses SIMD kernel).
+     */
+    template <class T>
+    class FirFilter
+    {
+        const size_t WindowSize;
+        T* samples = nullptr; // 2 * WindowSize (mirrored)
+        T* coefficients = nullptr; // in the reversed order (the oldest sample first)
+        size_t oldestIndex = 0; // window is samples[oldestIndex .. oldestIndex + WindowSize)
+
+
+    public:
+        /**
+         * @brief Construct a new filter with all coefficients equal to 0.
+         * @param windowSize Amount of filter taps (samples used to compute the output).
+         */
+        explicit FirFilter(size_t windowSize)
+            : WindowSize(windowSize)
+        {
+            if (WindowSize > 0)
+            {
+                samples = new T[2 * WindowSize];
+                coefficients = new T[WindowSize];
+            }
+
+            for (size_t i = 0; i < WindowSize; i++)
+                coefficients[i] = 0;
+            reset();
+        }
+
+
+        /**
+         * @brief Construct a new filter.
+         * @param coefficients Array of windowSize coefficients
+         * (coefficients[0] is applied to the newest sample).
+         * @param windowSize Amount of filter taps.
+         */
+        FirFilter(const T* coefficients, size_t windowSize)
+            : FirFilter(windowSize)
+        {
+            setCoefficients(coefficients);
+        }
+
+
+        FirFilter(const FirFilter& other)
+            : FirFilter(other.WindowSize)
+        {
+            oldestIndex = other.oldestIndex;
+            for (size_t i = 0; i < 2 * WindowSize; i++)
+                samples[i] = other.samples[i];
+            for (size_t i = 0; i < WindowSize; i++)
+                coefficients[i] = other.coefficients[i];
+        }
+
+
+        FirFilter& operator=(const FirFilter& other) = delete;
+
+
+        ~FirFilter()
+        {
+            delete[] samples;
+            delete[] coefficients;
+        }
+
+
+        /**
+         * @brief Change the filter coefficients (samples are unchanged).
+         * @param newCoefficients Array of getWindowSize() coefficients
+         * (newCoefficients[0] is applied to the newest sample).
+         */
+        void setCoefficients(const T* newCoefficients)
+        {
+            for (size_t i = 0; i < WindowSize; i++)
+                coefficients[WindowSize - 1 - i] = newCoefficients[i];
+        }
+
+
+        /**
+         * @brief Set all coefficients to 1 / windowSize (filter output is the moving average).
+         * Only for floating point T (1 / windowSize would be 0 for integers).
+         */
+        void setMovingAverage()
+        {
+            static_assert(std::is_floating_point<T>::value, "Moving average coefficients need floating point type");
+
+            for (size_t i = 0; i < WindowSize; i++)
+                coefficients[i] = (T)1 / (T)WindowSize;
+        }
+
+
+        /**
+         * @brief Set all samples to 0.
+         */
+        void reset()
+        {
+            for (size_t i = 0; i < 2 * WindowSize; i++)
+                samples[i] = 0;
+            oldestIndex = 0;
+        }
+
+
+        /**
+         * @brief Add new sample to the window (the oldest one is removed).
+         */
+        void push(const T& sample)
+        {
+            if (WindowSize == 0)
+                return;
+
+            // the oldest sample is replaced in both copies
+            samples[oldestIndex] = sample;
+            samples[oldestIndex + WindowSize] = sample;
+            oldestIndex = oldestIndex + 1 == WindowSize ? 0 : oldestIndex + 1;
+        }
+
+
+        /**
+         * @brief Add new sample and compute the filter output.
+         */
+        T filter(const T& sample)
+        {
+            push(sample);
+            return getOutput();
+        }
+
+
+        /**
+         * @return Filter output for the current window.
+         */
+        T getOutput() const
+        {
+            if (WindowSize == 0)
+                return 0;
+
+            return SimdKernels::dotProduct<T>(samples + oldestIndex, coefficients, WindowSize);
+        }
+
+
+        /**
+         * @return All samples in the window, from the oldest to the newest
+         * (valid until the next push).
+         */
+        Span<const T> getWindow() const
+        {
+            return Span<const T>(samples + oldestIndex, WindowSize);
+        }
+
+
+        size_t getWindowSize() const
+        {
+            return WindowSize;
+        }
+    };
+}
+
+
+#endif
@@ -0,0 +1,243 @@
+/**
+ * @file FlatMap.h
+ * @author Jan Wielgus
+ * @brief Map stored as the array of key-value pairs sorted by key.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef FLATMAP_H
+#define FLATMAP_H
+
+#include "IMap.h"
+#include "SortedArray.h"
+#include <functional>
+#include <utility>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Map for small tables (config, parameters...). Pairs are kept
+     * in the contiguous GrowingArray sorted by key, so lookup is O(log n)
+     * binary search without any pointers to follow and the memory overhead is minimal.
+     * Inserting and erasing single keys is O(n), use insertMany() to build the map.
+     * @tparam K Type of keys.
+     * @tparam V Type of values.
+     * @tparam Compare Functor, compare(a, b) is true if key a should be before key b.
+     */
+    template <class K, class V, class Compare = std::less<K>>
+    class FlatMap : public IMap<K, V>
+    {
+    public:
+        struct Entry
+        {
+            K key;
+            V value;
+        };
+
+    private:
+        // pair in the array, operator== (required by PlainGrowingArray::find()) compares
+        // only keys, so values don't have to be comparable
+        struct StoredEntry : Entry
+        {
+            StoredEntry() = default;
+            StoredEntry(const Entry& entry) : Entry(entry) {}
+            StoredEntry(Entry&& entry) : Entry(std::move(entry)) {}
+
+            bool operator==(const StoredEntry& other) const
+            {
+                return this->key == other.key;
+            }
+        };
+
+        // compares entries (and entries with keys) by key
+        class EntryCompare
+        {
+            Compare compare;
+
+        public:
+            explicit EntryCompare(const Compare& compare)
+                : compare(compare)
+            {
+            }
+
+            bool operator()(const Entry& a, const Entry& b) const { return compare(a.key, b.key); }
+            bool operator()(const Entry& a, const K& b) const { return compare(a.key, b); }
+            bool operator()(const K& a, const Entry& b) const { return compare(a, b.key); }
+        };
+
+        PlainGrowingArray<StoredEntry> entries;
+        EntryCompare entryCompare;
+
+
+    public:
+        explicit FlatMap(const Compare& compare = Compare())
+            : entryCompare(compare)
+        {
+        }
+
+
+        bool insert(const K& key, const V& value) override
+        {
+            size_t index = lowerBound(key);
+            if (isKeyAt(index, key))
+                return false;
+
+            return entries.add(Entry{ key, value }, index);
+        }
+
+
+        bool set(const K& key, const V& value) override
+        {
+            size_t index = lowerBound(key);
+            if (isKeyAt(index, key))
+            {
+                entries[index].value = value;
+                return true;
+            }
+
+            return entries.add(Entry{ key, value }, index);
+        }
+
+
+        /**
+         * @brief Adds many pairs at once. New pairs are copied to the array end, sorted there
+         * and merged with the existing ones. Existing keys are not changed, from duplicated
+         * new keys the first one is used.
+         * @param newEntries Array of pairs to add.
+         * @param amount Amount of pairs in the newEntries array.
+         */
+        void insertMany(const Entry* newEntries, size_t amount)
+        {
+            if (amount == 0)
+                return;
+
+            size_t oldSize = entries.size();
+            entries.reserve(oldSize + amount);
+            for (size_t i = 0; i < amount; i++)
+                entries.add(newEntries[i]);
+
+            // merge is stable, so the first of equal keys is the old one (or the first new one)
+            SortedArrayUtils::sortAndMerge(entries.toArray(), oldSize, amount, entryCompare);
+            removeDuplicatedKeys();
+        }
+
+
+        bool erase(const K& key) override
+        {
+            size_t index = lowerBound(key);
+            if (!isKeyAt(index, key))
+                return false;
+
+            return entries.remove(index);
+        }
+
+
+        V* find(const K& key) override
+        {
+            size_t index = lowerBound(key);
+            return isKeyAt(index, key) ? &entries[index].value : nullptr;
+        }
+
+
+        const V* find(const K& key) const override
+        {
+            size_t index = lowerBound(key);
+            return isKeyAt(index, key) ? &entries[index].value : nullptr;
+        }
+
+
+        bool contains(const K& key) const override
+        {
+            return isKeyAt(lowerBound(key), key);
+        }
+
+
+        size_t size() const override
+        {
+            return entries.size();
+        }
+
+
+        bool isEmpty() const override
+        {
+            return entries.isEmpty();
+        }
+
+
+        void clear() override
+        {
+            entries.clear();
+        }
+
+
+        /**
+         * @return Index of the first pair which key is not less than the provided one.
+         */
+        size_t lowerBound(const K& key) const
+        {
+            return SortedArrayUtils::lowerBound(entries.toArray(), entries.size(), key, entryCompare);
+        }
+
+
+        /**
+         * @return Index of the first pair which key is greater than the provided one.
+         */
+        size_t upperBound(const K& key) const
+        {
+            return SortedArrayUtils::upperBound(entries.toArray(), entries.size(), key, entryCompare);
+        }
+
+
+        /**
+         * @return Pair at the index (pairs are sorted by key). Key shouldn't be changed.
+         */
+        Entry& getEntry(size_t index)
+        {
+            return entries[index];
+        }
+
+
+        const Entry& getEntry(size_t index) const
+        {
+            return entries[index];
+        }
+
+
+        void reserve(size_t newCapacity)
+        {
+            entries.reserve(newCapacity);
+        }
+
+
+    private:
+        bool isKeyAt(size_t index, const K& key) const
+        {
+            return index < entries.size() && !entryCompare(key, entries[index]);
+        }
+
+
+        /**
+         * @brief Leave only the first pair from every group of pairs with equal keys (one pass).
+         */
+        void removeDuplicatedKeys()
+        {
+            StoredEntry* elements = entries.toArray();
+            size_t length = entries.size();
+            if (length < 2)
+                return;
+
+            size_t last = 0; // index of the last unique pair
+            for (size_t i = 1; i < length; i++)
+                if (entryCompare(elements[last], elements[i]))
+                    if (++last != i)
+                        elements[last] = std::move(elements[i]);
+
+            entries.removeRange(last + 1, length);
+        }
+    };
+}
+
+
+#endif
@@ -2,8 +2,8 @@
  * @file GrowingArray.h
  * @author Jan Wielgus
  * @brief Array without fixed size.
- * Size is increased (by one) every time when full
- * and new element is added and size is not sufficient.
+ * Allocated size is increased (according to the growth policy)
+ * every time when full and new element is added.
  * @date 2020-08-03
  * 
  */
@@ -11,33 +11,50 @@
 #ifndef GROWINGARRAY_H
 #define GROWINGARRAY_H
 
-#include "IArray.h"
+#include "StaticInterfaces.h"
+#include "GrowthPolicy.h"
+#include "RawStorage.h"
+#include "SimdKernels.h"
+#include "RangeAlgorithms.h"
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <string.h>
 
 
 namespace SimpleDataStructures
 {
     /**
      * @brief Array without fixed size.
-     * Size is increased (by one) every time when full
+     * Allocated size is increased every time when full
      * and new element is added and size is not sufficient.
      * Size can also be increased manually at any time.
+     * Internal array is uninitialized storage, only elements
+     * that are in the array are constructed.
      * @tparam T Array type.
+     * @tparam GrowthPolicy Class with static nextCapacity(currentCapacity, minimumCapacity)
+     * method that decide how big the new allocated array will be
+     * (see GrowthPolicy.h). By default capacity is doubled (amortized O(1) add).
+     * This version has no virtual methods (implements the static ArrayInterface),
+     * use GrowingArray if the IArray or IList interface is needed.
      */
-    template <class T>
-    class GrowingArray : public IArray<T>
+    template <class T, class GrowthPolicy = DoublingGrowth>
+    class PlainGrowingArray : public ArrayInterface<PlainGrowingArray<T, GrowthPolicy>, T>
     {
-        T* array = nullptr;
+        T* array = nullptr; // uninitialized storage, only [0, arraySize) are constructed
         size_t AllocatedSize = 0;
         size_t arraySize = 0; // amt of elements in the array
 
         T null_item; // returned when provided index is out of bounds
 
+        static constexpr bool IsTriviallyCopyable = std::is_trivially_copyable<T>::value;
+
 
     public:
         /**
-         * @brief Construct a new empty GrowingArray object.
+         * @brief Construct a new empty PlainGrowingArray object.
          */
-        GrowingArray()
+        PlainGrowingArray()
         {
             array = nullptr;
             AllocatedSize = 0;
@@ -46,11 +63,11 @@ namespace SimpleDataStructures
 
 
         /**
-         * @brief Construct a new GrowingArray object and allocate
+         * @brief Construct a new PlainGrowingArray object and allocate
          * internal array of specified size.
          * @param initialSize Size of the allocated internal array.
          */
-        explicit GrowingArray(size_t initialSize)
+        explicit PlainGrowingArray(size_t initialSize)
         {
             ensureCapacity(initialSize, false);
             arraySize = 0;
@@ -63,22 +80,18 @@ namespace SimpleDataStructures
          * Size of the new object array is only the amount of data in other object array
          * (regardless of allocated data by other object).
          */
-        GrowingArray(const GrowingArray& other)
+        PlainGrowingArray(const PlainGrowingArray& other)
         {
             ensureCapacity(other.arraySize, false);
-
-            for (size_t i = 0; i < other.arraySize; i++)
-                array[i] = other.array[i];
-
-            arraySize = other.arraySize;
+            copyConstructFrom(other);
         }
 
 
         /**
          * @brief Move constructor.
-         * @param toMove GrowingArray to move.
+         * @param toMove PlainGrowingArray to move.
          */
-        GrowingArray(GrowingArray&& toMove)
+        PlainGrowingArray(PlainGrowingArray&& toMove)
         {
             array = toMove.array;
             AllocatedSize = toMove.AllocatedSize;
@@ -90,9 +103,9 @@ namespace SimpleDataStructures
         }
 
 
-        ~GrowingArray()
+        ~PlainGrowingArray()
         {
-            delete[] array;
+            clear();
         }
 
 
@@ -100,27 +113,26 @@ namespace SimpleDataStructures
          * @brief Overloaded assignment operator.
          * Size of the new array is only the amount of data inside the copied array.
          */
-        GrowingArray& operator=(const GrowingArray& other)
+        PlainGrowingArray& operator=(const PlainGrowingArray& other)
         {
             if (this != &other)
             {
-                ensureCapacity(other.arraySize, false);
+                destroyElements(0, arraySize);
+                arraySize = 0;
 
-                for (size_t i = 0; i < other.arraySize; i++)
-                    array[i] = other.array[i];
-                
-                arraySize = other.arraySize;
+                ensureCapacity(other.arraySize, false);
+                copyConstructFrom(other);
             }
 
             return *this;
         }
 
 
-        GrowingArray& operator=(GrowingArray&& toMove)
+        PlainGrowingArray& operator=(PlainGrowingArray&& toMove)
         {
             if (this != &toMove)
             {
-                delete[] array;
+                clear();
 
                 array = toMove.array;
                 AllocatedSize = toMove.AllocatedSize;
@@ -135,124 +147,366 @@ namespace SimpleDataStructures
         }
 
 
-        bool add(const T& item) override
+        bool add(const T& item)
         {
-            ensureCapacity(arraySize + 1); // TODO: should be always by one??
+            return emplace(item);
+        }
 
-            array[arraySize] = item;
-            arraySize++;
 
+        bool add(T&& item)
+        {
+            return emplace(std::move(item));
+        }
+
+
+        bool add(const T& item, size_t index)
+        {
+            return emplaceAt(index, item);
+        }
+
+
+        bool add(T&& item, size_t index)
+        {
+            return emplaceAt(index, std::move(item));
+        }
+
+
+        /**
+         * @brief Construct new item directly at the end of the array.
+         * @param args Arguments passed to the T constructor.
+         * @return true (array is never full).
+         */
+        template <class... Args>
+        bool emplace(Args&&... args)
+        {
+            if (arraySize < AllocatedSize)
+                new (array + arraySize) T(std::forward<Args>(args)...);
+            else
+            {
+                // args can reference an element of this array, so construct
+                // the new item in the new storage before old elements are relocated
+                size_t newCapacity = GrowthPolicy::nextCapacity(AllocatedSize, arraySize + 1);
+                T* biggerArray = allocate(newCapacity);
+                new (biggerArray + arraySize) T(std::forward<Args>(args)...);
+                replaceStorage(biggerArray, newCapacity, 1);
+            }
+
+            arraySize++;
             return true;
         }
 
 
-        bool add(const T& item, size_t index) override
+        /**
+         * @brief Construct new item at the specified index.
+         * Following items will be moved one place forward.
+         * @param index Index where to construct new item.
+         * @param args Arguments passed to the T constructor.
+         * @return false if index is out of bounds.
+         */
+        template <class... Args>
+        bool emplaceAt(size_t index, Args&&... args)
         {
             // prevent from making unassigned gap
             if (index > arraySize)
                 return false;
 
-            ensureCapacity(arraySize + 1);
+            if (index == arraySize)
+                return emplace(std::forward<Args>(args)...);
+
+            T newItem(std::forward<Args>(args)...); // args can be moved by shifting
+            grow(arraySize + 1);
 
             // Make place for a new item
-            for (size_t i = arraySize; i > index; i--)
-                array[i] = array[i-1];
+            if (IsTriviallyCopyable)
+            {
+                memmove((void*)(array + index + 1), (const void*)(array + index), (arraySize - index) * sizeof(T));
+                new (array + index) T(std::move(newItem));
+            }
+            else
+            {
+                new (array + arraySize) T(std::move(array[arraySize - 1]));
+                for (size_t i = arraySize - 1; i > index; i--)
+                    array[i] = std::move(array[i-1]);
+
+                array[index] = std::move(newItem);
+            }
 
-            array[index] = item;
             arraySize++;
             return true;
         }
 
 
-        bool remove(size_t index) override
+        bool remove(size_t index)
         {
             if (index >= arraySize)
                 return false;
-            
-            for (size_t i = index + 1; i < arraySize; i++)
-                array[i - 1] = array[i];
-            
+
+            if (IsTriviallyCopyable)
+                memmove((void*)(array + index), (const void*)(array + index + 1), (arraySize - index - 1) * sizeof(T));
+            else
+            {
+                for (size_t i = index + 1; i < arraySize; i++)
+                    array[i - 1] = std::move(array[i]);
+
+                array[arraySize - 1].~T();
+            }
+
             arraySize--;
             return true;
-            // TODO: add decreasing size of the allocated space
+            // allocated space is not decreased, use shrinkToFit() to release it
         }
 
 
-        T& get(size_t index) override
+        /**
+         * @brief Removes element in O(1) time by moving the last element in its place.
+         * Order of elements is not preserved.
+         * @return false if index is out of bounds.
+         */
+        bool removeUnordered(size_t index)
+        {
+            if (index >= arraySize)
+                return false;
+
+            size_t lastIndex = arraySize - 1;
+            if (index != lastIndex)
+                array[index] = std::move(array[lastIndex]);
+
+            destroyElements(lastIndex, arraySize);
+            arraySize--;
+            return true;
+        }
+
+
+        /**
+         * @brief Removes elements in range [first, last). Following elements
+         * are moved only once (by the whole block).
+         * @return false if range is invalid (nothing is removed).
+         */
+        bool removeRange(size_t first, size_t last)
+        {
+            if (first > last || last > arraySize)
+                return false;
+
+            size_t amount = last - first;
+            if (amount == 0)
+                return true;
+
+            if (IsTriviallyCopyable)
+                memmove((void*)(array + first), (const void*)(array + last), (arraySize - last) * sizeof(T));
+            else
+                for (size_t i = last; i < arraySize; i++)
+                    array[i - amount] = std::move(array[i]);
+
+            destroyElements(arraySize - amount, arraySize);
+            arraySize -= amount;
+            return true;
+        }
+
+
+        /**
+         * @brief Removes all elements for which predicate(element) is true
+         * in one pass (remaining elements keep their order).
+         * @return Amount of removed elements.
+         */
+        template <class Predicate>
+        size_t removeIf(Predicate predicate)
+        {
+            size_t kept = 0;
+            for (size_t i = 0; i < arraySize; i++)
+            {
+                if (predicate((const T&)array[i]))
+                    continue;
+
+                if (kept != i)
+                    array[kept] = std::move(array[i]);
+                kept++;
+            }
+
+            size_t removed = arraySize - kept;
+            destroyElements(kept, arraySize);
+            arraySize = kept;
+            return removed;
+        }
+
+
+        /**
+         * @brief Removes all elements equal to the item in one pass.
+         * @return Amount of removed elements.
+         */
+        size_t removeAll(const T& item)
+        {
+            // item could be an element of this array that will be overwritten
+            const T value(item);
+            return removeIf([&value](const T& element) { return element == value; });
+        }
+
+
+        T& get(size_t index)
         {
             return index < arraySize ? array[index] : null_item;
         }
 
 
-        const T& get(size_t index) const override
+        const T& get(size_t index) const
         {
             return index < arraySize ? array[index] : null_item;
         }
 
 
-        T& operator[](size_t index) override
+        T& operator[](size_t index)
         {
             return index < arraySize ? array[index] : null_item;
         }
 
 
-        const T& operator[](size_t index) const override
+        const T& operator[](size_t index) const
         {
             return index < arraySize ? array[index] : null_item;
         }
 
 
-        T* toArray() override
+        T* toArray()
         {
             return array;
         }
 
 
-        const T* toArray() const override
+        const T* toArray() const
         {
             return array;
         }
 
 
-        bool replace(const T& newItem, size_t index) override
+        bool replace(const T& newItem, size_t index)
         {
             if (index >= arraySize)
                 return false;
-            
+
             array[index] = newItem;
             return true;
         }
 
 
-        size_t find(const T& itemToFind, size_t startIndex = 0) const override
+        bool replace(T&& newItem, size_t index)
+        {
+            if (index >= arraySize)
+                return false;
+
+            array[index] = std::move(newItem);
+            return true;
+        }
+
+
+        /**
+         * @brief Linear search (vectorized for arithmetic types, see SimdKernels::find()).
+         */
+        size_t find(const T& itemToFind, size_t startIndex = 0) const
         {
-            for (size_t i = startIndex; i < arraySize; i++)
-                if (array[i] == itemToFind)
-                    return i;
-            
-            return npos;
+            if (startIndex >= arraySize)
+                return npos;
+
+            size_t index = startIndex + SimdKernels::find(array + startIndex, arraySize - startIndex, itemToFind);
+            return index < arraySize ? index : npos;
         }
 
 
-        bool contains(const T& itemToFind) const override
+        bool contains(const T& itemToFind) const
         {
             return find(itemToFind) != npos;
         }
 
 
-        size_t size() const override
+        size_t size() const
         {
             return arraySize;
         }
 
 
-        bool isFull() const override
+        /**
+         * @brief Iterators for the range-based for loop and STL algorithms
+         * (pointers to the first element and after the last one).
+         */
+        T* begin()
+        {
+            return array;
+        }
+
+
+        T* end()
+        {
+            return array + arraySize;
+        }
+
+
+        const T* begin() const
+        {
+            return array;
+        }
+
+
+        const T* end() const
+        {
+            return array + arraySize;
+        }
+
+
+        /**
+         * @brief Call function(element) for every element (from the first one).
+         * Function is inlined into a plain loop over the array (no virtual calls like through IList).
+         */
+        template <class Function>
+        void forEach(Function&& function)
+        {
+            RangeAlgorithms::forEach(array, arraySize, function);
+        }
+
+
+        template <class Function>
+        void forEach(Function&& function) const
+        {
+            RangeAlgorithms::forEach((const T*)array, arraySize, function);
+        }
+
+
+        /**
+         * @brief Fold all elements: result = function(result, element), starting with init.
+         * @return Final result.
+         */
+        template <class Result, class Function>
+        Result reduce(Result init, Function&& function) const
+        {
+            return RangeAlgorithms::reduce(array, arraySize, init, function);
+        }
+
+
+        /**
+         * @brief Replace every element with function(element). Vectorized by the compiler
+         * for simple functions on arithmetic types.
+         */
+        template <class Function>
+        void transformInPlace(Function&& function)
+        {
+            RangeAlgorithms::transformInPlace(array, arraySize, function);
+        }
+
+
+        /**
+         * @return Amount of elements for which predicate(element) is true.
+         */
+        template <class Predicate>
+        size_t countIf(Predicate&& predicate) const
+        {
+            return RangeAlgorithms::countIf(array, arraySize, predicate);
+        }
+
+
+        bool isFull() const
         {
             return false;
         }
 
 
-        bool isEmpty() const override
+        bool isEmpty() const
         {
             return arraySize == 0;
         }
@@ -261,9 +515,10 @@ namespace SimpleDataStructures
         /**
          * @brief Remove all data and free the allocated memory.
          */
-        void clear() override
+        void clear()
         {
-            delete [] array;
+            destroyElements(0, arraySize);
+            deallocate(array);
             array = nullptr;
             AllocatedSize = 0;
             arraySize = 0;
@@ -294,37 +549,192 @@ namespace SimpleDataStructures
         }
 
 
+        /**
+         * @brief Allocate space for at least newCapacity elements,
+         * so that adding up to that amount of elements won't cause reallocation.
+         * Same as ensureCapacity(). Don't shrink the allocated space.
+         * @param newCapacity Minimum size that array should have.
+         */
+        void reserve(size_t newCapacity)
+        {
+            ensureCapacity(newCapacity, true);
+        }
+
+
+        /**
+         * @brief Reduce size of the allocated array to the amount of elements inside.
+         * Releases all the memory if array is empty.
+         */
+        void shrinkToFit()
+        {
+            if (arraySize == AllocatedSize)
+                return;
+
+            if (arraySize == 0)
+            {
+                clear();
+                return;
+            }
+
+            replaceStorage(allocate(arraySize), arraySize);
+        }
+
+
     private:
+        /**
+         * @brief Make place for at least minimumSize elements.
+         * If reallocation is needed, new size is chosen by the GrowthPolicy.
+         * @param minimumSize Minimum size that array should have.
+         */
+        void grow(size_t minimumSize)
+        {
+            if (minimumSize <= AllocatedSize)
+                return;
+
+            ensureCapacity(GrowthPolicy::nextCapacity(AllocatedSize, minimumSize), true);
+        }
+
+
         /**
          * @brief Make array to have at least provided size.
          * If need to allocate new bigger array, keepData flag
-         * decide if should copy old data to the new array or not.
+         * decide if should move old data to the new array or not.
          * This method don't shrink the allocated space.
          * @param minimumSize Minimum size that array should have.
          * @param keepData Flag. If true: after reallocation all
-         * previous data will be copied. If false: in such situation
-         * prev data won't be copied. 
+         * previous data will be moved. If false: in such situation
+         * prev data will be destroyed (array will be empty).
          */
         void ensureCapacity(size_t minimumSize, bool keepData)
         {
             if (minimumSize <= AllocatedSize)
                 return;
-            
-            if (array == nullptr)
-                array = new T[minimumSize];
+
+            if (!keepData)
+            {
+                destroyElements(0, arraySize);
+                arraySize = 0;
+            }
+
+            replaceStorage(allocate(minimumSize), minimumSize);
+        }
+
+
+        /**
+         * @brief Relocate all elements to the newStorage (using memcpy for trivially copyable
+         * types and move constructor otherwise) and release the old storage.
+         * Old elements are destroyed only after all of them were constructed in the newStorage,
+         * so if copying throws, array is left unchanged (newStorage is released).
+         * @param newStorage Uninitialized storage for at least arraySize elements.
+         * @param newCapacity Size of the newStorage.
+         * @param constructedAfter Amount of elements already constructed in the newStorage
+         * after the relocated ones (destroyed too if copying throws).
+         */
+        void replaceStorage(T* newStorage, size_t newCapacity, size_t constructedAfter = 0)
+        {
+            if (IsTriviallyCopyable)
+            {
+                if (arraySize > 0)
+                    memcpy((void*)newStorage, (const void*)array, arraySize * sizeof(T));
+            }
             else
             {
-                T* biggerArray = new T[minimumSize];
-
-                if (keepData)
-                    for (size_t i = 0; i < arraySize; i++)
-                        biggerArray[i] = array[i];
-                
-                delete[] array;
-                array = biggerArray;
+                size_t i = 0;
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                try
+                {
+#endif
+                    for (; i < arraySize; i++)
+                        new (newStorage + i) T(std::move_if_noexcept(array[i]));
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+                }
+                catch (...)
+                {
+                    for (size_t j = 0; j < i; j++)
+                        newStorage[j].~T();
+                    for (size_t j = arraySize; j < arraySize + constructedAfter; j++)
+                        newStorage[j].~T();
+                    deallocate(newStorage);
+                    throw;
+                }
+#endif
+
+                destroyElements(0, arraySize);
             }
 
-            AllocatedSize = minimumSize;
+            deallocate(array);
+            array = newStorage;
+            AllocatedSize = newCapacity;
+        }
+
+
+        /**
+         * @brief Copy construct all elements of other array at the end of this array.
+         * Capacity have to be already sufficient.
+         */
+        void copyConstructFrom(const PlainGrowingArray& other)
+        {
+            if (IsTriviallyCopyable)
+            {
+                if (other.arraySize > 0)
+                    memcpy((void*)(array + arraySize), (const void*)other.array, other.arraySize * sizeof(T));
+                arraySize += other.arraySize;
+            }
+            else
+            {
+                for (size_t i = 0; i < other.arraySize; i++)
+                {
+                    new (array + arraySize) T(other.array[i]);
+                    arraySize++;
+                }
+            }
+        }
+
+
+        /**
+         * @brief Call destructors of elements in range [first, last).
+         */
+        void destroyElements(size_t first, size_t last)
+        {
+            if (!std::is_trivially_destructible<T>::value)
+                for (size_t i = first; i < last; i++)
+                    array[i].~T();
+        }
+
+
+        static T* allocate(size_t amount)
+        {
+            return RawStorage::allocate<T>(amount);
+        }
+
+
+        static void deallocate(T* storage)
+        {
+            RawStorage::deallocate(storage);
+        }
+    };
+
+
+
+    /**
+     * @brief PlainGrowingArray that implements the virtual IArray interface
+     * (added by VirtualArrayAdapter, costs a vtable pointer in the object).
+     */
+    template <class T, class GrowthPolicy = DoublingGrowth>
+    class GrowingArray : public VirtualArrayAdapter<PlainGrowingArray<T, GrowthPolicy>>
+    {
+    public:
+        GrowingArray()
+        {
+        }
+
+
+        /**
+         * @param initialSize Size of the allocated internal array.
+         */
+        explicit GrowingArray(size_t initialSize)
+            : VirtualArrayAdapter<PlainGrowingArray<T, GrowthPolicy>>(initialSize)
+        {
         }
     };
 }
@@ -0,0 +1,635 @@
+/**
+ * @file GrowingQueue.h
+ * @author Jan Wielgus
+ * @brief Queue (and double-ended queue) without fixed size.
+ * Ring buffer that is reallocated when full (up to the max capacity).
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef GROWINGQUEUE_H
+#define GROWINGQUEUE_H
+
+#include "IRandomAccessQueue.h"
+#include "GrowthPolicy.h"
+#include "RawStorage.h"
+#include "RangeAlgorithms.h"
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <string.h>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Growable ring buffer with amortized O(1) adding and removing
+     * at both ends. When full, elements are moved once to the new bigger array
+     * (the ring is straightened, so the first element lands at index 0).
+     * enqueue() fails only if the max capacity is reached.
+     * Optionally, allocated space is halved when queue becomes a quarter full
+     * (but not below the initial capacity).
+     * @tparam T Type of stored elements.
+     * @tparam GrowthPolicy Decides how big the new array will be (see GrowthPolicy.h).
+     */
+    template <class T, class GrowthPolicy = DoublingGrowth>
+    class GrowingQueue : public IRandomAccessQueue<T>
+    {
+    public:
+        static const size_t NoLimit = (size_t)-1;
+
+    private:
+        T* array = nullptr; // uninitialized storage, only queue elements are constructed
+        size_t AllocatedSize = 0;
+        size_t queueFrontIndex = 0;
+        size_t queueLength = 0;
+
+        size_t InitialCapacity;
+        size_t MaxCapacity;
+        bool shrinkOnDrain = false;
+
+        T null_item; // element returned when queue is empty
+        T lastDequeued; // dequeue() returns reference to it (the slot is released)
+
+        static constexpr bool IsTriviallyCopyable = std::is_trivially_copyable<T>::value;
+
+
+    public:
+        /**
+         * @brief Construct a new GrowingQueue object.
+         * @param initialCapacity Size of the array allocated at the beginning
+         * (and the minimum size when shrinking).
+         * @param maxCapacity Max amount of elements in the queue (NoLimit by default).
+         */
+        explicit GrowingQueue(size_t initialCapacity = 0, size_t maxCapacity = NoLimit)
+            : InitialCapacity(initialCapacity < maxCapacity ? initialCapacity : maxCapacity),
+            MaxCapacity(maxCapacity)
+        {
+            relocate(InitialCapacity);
+        }
+
+
+        GrowingQueue(const GrowingQueue& other)
+            : InitialCapacity(other.InitialCapacity), MaxCapacity(other.MaxCapacity),
+            shrinkOnDrain(other.shrinkOnDrain)
+        {
+            copyFrom(other);
+        }
+
+
+        GrowingQueue(GrowingQueue&& toMove)
+            : InitialCapacity(toMove.InitialCapacity), MaxCapacity(toMove.MaxCapacity),
+            shrinkOnDrain(toMove.shrinkOnDrain)
+        {
+            takeStorageFrom(toMove);
+        }
+
+
+        ~GrowingQueue()
+        {
+            destroyElements();
+            RawStorage::deallocate(array);
+        }
+
+
+        GrowingQueue& operator=(const GrowingQueue& other)
+        {
+            if (this != &other)
+            {
+                destroyElements();
+                InitialCapacity = other.InitialCapacity;
+                MaxCapacity = other.MaxCapacity;
+                shrinkOnDrain = other.shrinkOnDrain;
+                copyFrom(other);
+            }
+
+            return *this;
+        }
+
+
+        GrowingQueue& operator=(GrowingQueue&& toMove)
+        {
+            if (this != &toMove)
+            {
+                destroyElements();
+                RawStorage::deallocate(array);
+                InitialCapacity = toMove.InitialCapacity;
+                MaxCapacity = toMove.MaxCapacity;
+                shrinkOnDrain = toMove.shrinkOnDrain;
+                takeStorageFrom(toMove);
+            }
+
+            return *this;
+        }
+
+
+        /**
+         * @brief Removes all elements. Allocated space is kept,
+         * unless shrink on drain is enabled (then it is reduced to the initial capacity).
+         */
+        void clear() override
+        {
+            destroyElements();
+            queueFrontIndex = 0;
+
+            if (shrinkOnDrain)
+                relocate(InitialCapacity);
+        }
+
+
+        /**
+         * @brief Adds item to the end of the queue.
+         * @return false if max capacity is reached (or allocation failed).
+         */
+        bool enqueue(const T& item) override
+        {
+            return emplaceBack(item);
+        }
+
+
+        bool enqueue(T&& item)
+        {
+            return emplaceBack(std::move(item));
+        }
+
+
+        /**
+         * @brief Adds item to the beginning of the queue (it will be dequeued first).
+         * @return false if max capacity is reached (or allocation failed).
+         */
+        bool enqueueFront(const T& item)
+        {
+            return emplaceFront(item);
+        }
+
+
+        bool enqueueFront(T&& item)
+        {
+            return emplaceFront(std::move(item));
+        }
+
+
+        /**
+         * @brief Constructs new element at the end of the queue.
+         * @param args Arguments passed to the T constructor.
+         * @return false if max capacity is reached (or allocation failed).
+         */
+        template <class... Args>
+        bool emplaceBack(Args&&... args)
+        {
+            if (queueLength < AllocatedSize)
+                new (array + physicalIndex(queueLength)) T(std::forward<Args>(args)...);
+            else
+            {
+                size_t newCapacity = capacityForOneMore();
+                if (newCapacity == 0)
+                    return false;
+
+                // args can reference an element of this queue, so construct
+                // the new item in the new storage before old elements are relocated
+                T* biggerArray = RawStorage::allocate<T>(newCapacity);
+                new (biggerArray + queueLength) T(std::forward<Args>(args)...);
+                replaceStorage(biggerArray, newCapacity, 0, biggerArray + queueLength);
+            }
+
+            queueLength++;
+            return true;
+        }
+
+
+        /**
+         * @brief Constructs new element at the beginning of the queue.
+         * @param args Arguments passed to the T constructor.
+         * @return false if max capacity is reached (or allocation failed).
+         */
+        template <class... Args>
+        bool emplaceFront(Args&&... args)
+        {
+            if (queueLength < AllocatedSize)
+            {
+                size_t newFrontIndex = queueFrontIndex == 0 ? AllocatedSize - 1 : queueFrontIndex - 1;
+                new (array + newFrontIndex) T(std::forward<Args>(args)...);
+                queueFrontIndex = newFrontIndex;
+            }
+            else
+            {
+                size_t newCapacity = capacityForOneMore();
+                if (newCapacity == 0)
+                    return false;
+
+                // the same as in emplaceBack(), old elements are placed after the new one
+                T* biggerArray = RawStorage::allocate<T>(newCapacity);
+                new (biggerArray) T(std::forward<Args>(args)...);
+                replaceStorage(biggerArray, newCapacity, 1, biggerArray);
+                queueFrontIndex = 0;
+            }
+
+            queueLength++;
+            return true;
+        }
+
+
+        /**
+         * @brief Removes the first element.
+         * @return Reference to the dequeued element (valid until the next dequeue)
+         * or null item if queue is empty.
+         */
+        T& dequeue() override
+        {
+            if (queueLength == 0)
+                return null_item;
+
+            lastDequeued = std::move(array[queueFrontIndex]);
+            array[queueFrontIndex].~T();
+            queueFrontIndex = physicalIndex(1);
+            queueLength--;
+
+            shrinkIfDrained();
+            return lastDequeued;
+        }
+
+
+        /**
+         * @brief Removes the last element.
+         * @return Reference to the dequeued element (valid until the next dequeue)
+         * or null item if queue is empty.
+         */
+        T& dequeueBack()
+        {
+            if (queueLength == 0)
+                return null_item;
+
+            T& last = array[physicalIndex(queueLength - 1)];
+            lastDequeued = std::move(last);
+            last.~T();
+            queueLength--;
+
+            shrinkIfDrained();
+            return lastDequeued;
+        }
+
+
+        /**
+         * @brief Removes element at the index. Elements on the shorter side
+         * of it are moved by one place.
+         * @return Reference to the dequeued element (valid until the next dequeue)
+         * or null item if index is out of bounds.
+         */
+        T& dequeue(size_t index) override
+        {
+            if (index >= queueLength)
+                return null_item;
+
+            lastDequeued = std::move(array[physicalIndex(index)]);
+
+            if (index < queueLength / 2)
+            {
+                for (size_t i = index; i > 0; i--)
+                    array[physicalIndex(i)] = std::move(array[physicalIndex(i - 1)]);
+                array[queueFrontIndex].~T();
+                queueFrontIndex = physicalIndex(1);
+            }
+            else
+            {
+                for (size_t i = index; i + 1 < queueLength; i++)
+                    array[physicalIndex(i)] = std::move(array[physicalIndex(i + 1)]);
+                array[physicalIndex(queueLength - 1)].~T();
+            }
+            queueLength--;
+
+            shrinkIfDrained();
+            return lastDequeued;
+        }
+
+
+        T& peek() override
+        {
+            return queueLength == 0 ? null_item : array[queueFrontIndex];
+        }
+
+
+        const T& peek() const override
+        {
+            return queueLength == 0 ? null_item : array[queueFrontIndex];
+        }
+
+
+        T& peek(size_t index) override
+        {
+            return index < queueLength ? array[physicalIndex(index)] : null_item;
+        }
+
+
+        const T& peek(size_t index) const override
+        {
+            return index < queueLength ? array[physicalIndex(index)] : null_item;
+        }
+
+
+        /**
+         * @return Reference to the last element or null item if queue is empty.
+         */
+        T& peekBack()
+        {
+            return queueLength == 0 ? null_item : array[physicalIndex(queueLength - 1)];
+        }
+
+
+        const T& peekBack() const
+        {
+            return queueLength == 0 ? null_item : array[physicalIndex(queueLength - 1)];
+        }
+
+
+        /**
+         * @brief Call function(element) for every element (from the front).
+         * The ring is processed as two contiguous parts, so simple functions are vectorized.
+         */
+        template <class Function>
+        void forEach(Function&& function)
+        {
+            RangeAlgorithms::forEachInRing(array, AllocatedSize, queueFrontIndex, queueLength, function);
+        }
+
+
+        template <class Function>
+        void forEach(Function&& function) const
+        {
+            RangeAlgorithms::forEachInRing((const T*)array, AllocatedSize, queueFrontIndex, queueLength, function);
+        }
+
+
+        /**
+         * @brief Fold all elements from the front: result = function(result, element), starting with init.
+         * @return Final result.
+         */
+        template <class Result, class Function>
+        Result reduce(Result init, Function&& function) const
+        {
+            return RangeAlgorithms::reduceRing(array, AllocatedSize, queueFrontIndex, queueLength, init, function);
+        }
+
+
+        /**
+         * @brief Replace every element with function(element).
+         */
+        template <class Function>
+        void transformInPlace(Function&& function)
+        {
+            RangeAlgorithms::transformRing(array, AllocatedSize, queueFrontIndex, queueLength, function);
+        }
+
+
+        /**
+         * @return Amount of elements for which predicate(element) is true.
+         */
+        template <class Predicate>
+        size_t countIf(Predicate&& predicate) const
+        {
+            return RangeAlgorithms::countIfInRing(array, AllocatedSize, queueFrontIndex, queueLength, predicate);
+        }
+
+
+        bool isEmpty() const override
+        {
+            return queueLength == 0;
+        }
+
+
+        /**
+         * @return true if max capacity is reached.
+         */
+        bool isFull() const override
+        {
+            return queueLength >= MaxCapacity;
+        }
+
+
+        size_t getQueueLength() const override
+        {
+            return queueLength;
+        }
+
+
+        /**
+         * @return Size of the allocated array.
+         */
+        size_t getCapacity() const
+        {
+            return AllocatedSize;
+        }
+
+
+        size_t getMaxCapacity() const
+        {
+            return MaxCapacity;
+        }
+
+
+        /**
+         * @brief Enable or disable halving the allocated space when queue
+         * becomes a quarter full (and releasing it to the initial capacity in clear()).
+         */
+        void setShrinkOnDrain(bool enabled)
+        {
+            shrinkOnDrain = enabled;
+        }
+
+
+        /**
+         * @brief Allocate space for at least newCapacity elements
+         * (limited by the max capacity). Don't shrink the allocated space.
+         */
+        void reserve(size_t newCapacity)
+        {
+            if (newCapacity > MaxCapacity)
+                newCapacity = MaxCapacity;
+
+            if (newCapacity > AllocatedSize)
+                relocate(newCapacity);
+        }
+
+
+        /**
+         * @brief Reduce size of the allocated array to the amount of elements inside.
+         */
+        void shrinkToFit()
+        {
+            if (queueLength < AllocatedSize)
+                relocate(queueLength);
+        }
+
+
+    private:
+        /**
+         * @return Index in the array of the element at the queue index.
+         */
+        size_t physicalIndex(size_t index) const
+        {
+            size_t result = queueFrontIndex + index;
+            return result >= AllocatedSize ? result - AllocatedSize : result;
+        }
+
+
+        /**
+         * @return Size of the bigger array for the full queue or 0 if max capacity is reached.
+         */
+        size_t capacityForOneMore() const
+        {
+            if (queueLength >= MaxCapacity)
+                return 0;
+
+            size_t newCapacity = GrowthPolicy::nextCapacity(AllocatedSize, queueLength + 1);
+            return newCapacity < MaxCapacity ? newCapacity : MaxCapacity;
+        }
+
+
+        void shrinkIfDrained()
+        {
+            if (!shrinkOnDrain || queueLength > AllocatedSize / 4)
+                return;
+
+            size_t newCapacity = AllocatedSize / 2;
+            if (newCapacity < InitialCapacity)
+                newCapacity = InitialCapacity;
+
+            if (newCapacity < AllocatedSize)
+                relocate(newCapacity);
+        }
+
+
+        /**
+         * @brief Move all elements to the new array of newCapacity size
+         * (at least queueLength), so that the first one is at index 0.
+         * Ring is copied in at most two contiguous parts.
+         */
+        void relocate(size_t newCapacity)
+        {
+            replaceStorage(RawStorage::allocate<T>(newCapacity), newCapacity, 0);
+        }
+
+
+        /**
+         * @brief Move elements to the new storage (in order, starting at the offset)
+         * and release the old array. Old elements are destroyed only after all of them
+         * were constructed in the new storage, so if copying throws, the queue is left
+         * unchanged (new storage with its elements is released).
+         * @param newStorage Uninitialized storage for at least offset + queueLength elements.
+         * @param newCapacity Size of the new storage.
+         * @param offset Index in the new storage of the first element.
+         * @param newItem Item already constructed in the new storage (destroyed too
+         * if copying throws) or nullptr.
+         */
+        void replaceStorage(T* newStorage, size_t newCapacity, size_t offset, T* newItem = nullptr)
+        {
+            size_t firstPart = AllocatedSize - queueFrontIndex;
+            if (firstPart > queueLength)
+                firstPart = queueLength;
+
+            size_t constructed = 0;
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            try
+            {
+#endif
+                moveConstructElements(newStorage + offset, array + queueFrontIndex, firstPart, constructed);
+                moveConstructElements(newStorage + offset + firstPart, array, queueLength - firstPart, constructed);
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            }
+            catch (...)
+            {
+                destroyElements(newStorage + offset, constructed);
+                if (newItem != nullptr)
+                    newItem->~T();
+                RawStorage::deallocate(newStorage);
+                throw;
+            }
+#endif
+
+            destroyElements(array + queueFrontIndex, firstPart);
+            destroyElements(array, queueLength - firstPart);
+
+            RawStorage::deallocate(array);
+            array = newStorage;
+            AllocatedSize = newCapacity;
+            queueFrontIndex = offset;
+        }
+
+
+        /**
+         * @brief Move construct amount elements to the uninitialized destination
+         * (memcpy for trivially copyable types).
+         * @param constructed Increased by the amount of constructed elements.
+         */
+        static void moveConstructElements(T* destination, T* source, size_t amount, size_t& constructed)
+        {
+            if (amount == 0)
+                return;
+
+            if (IsTriviallyCopyable)
+            {
+                memcpy((void*)destination, (const void*)source, amount * sizeof(T));
+                constructed += amount;
+            }
+            else
+                for (size_t i = 0; i < amount; i++)
+                {
+                    new (destination + i) T(std::move_if_noexcept(source[i]));
+                    constructed++;
+                }
+        }
+
+
+        static void destroyElements(T* elements, size_t amount)
+        {
+            if (!std::is_trivially_destructible<T>::value)
+                for (size_t i = 0; i < amount; i++)
+                    elements[i].~T();
+        }
+
+
+        void destroyElements()
+        {
+            if (!std::is_trivially_destructible<T>::value)
+                for (size_t i = 0; i < queueLength; i++)
+                    array[physicalIndex(i)].~T();
+
+            queueLength = 0;
+        }
+
+
+        /**
+         * @brief Copy other queue elements (this queue have to be empty).
+         * New array has the size of the other queue length (at least initial capacity).
+         */
+        void copyFrom(const GrowingQueue& other)
+        {
+            size_t newCapacity = other.queueLength < InitialCapacity ? InitialCapacity : other.queueLength;
+            if (newCapacity != AllocatedSize)
+                relocate(newCapacity);
+            queueFrontIndex = 0;
+
+            for (size_t i = 0; i < other.queueLength; i++)
+            {
+                new (array + i) T(other.array[other.physicalIndex(i)]);
+                queueLength++;
+            }
+        }
+
+
+        void takeStorageFrom(GrowingQueue& toMove)
+        {
+            array = toMove.array;
+            AllocatedSize = toMove.AllocatedSize;
+            queueFrontIndex = toMove.queueFrontIndex;
+            queueLength = toMove.queueLength;
+
+            toMove.array = nullptr;
+            toMove.AllocatedSize = 0;
+            toMove.queueFrontIndex = 0;
+            toMove.queueLength = 0;
+        }
+    };
+}
+
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * @file GrowthPolicy.h
+ * @author Jan Wielgus
+ * @brief Policies that decide how much memory growing containers
+ * allocate when they run out of space.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef GROWTHPOLICY_H
+#define GROWTHPOLICY_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Allocate exactly as much as is needed.
+     * Every add() to the full container cause reallocation (O(n) per add).
+     * Use only when memory is really tight.
+     */
+    class ExactGrowth
+    {
+    public:
+        static size_t nextCapacity(size_t currentCapacity, size_t minimumCapacity)
+        {
+            (void)currentCapacity;
+            return minimumCapacity;
+        }
+    };
+
+
+    /**
+     * @brief Grow by a fixed amount of elements.
+     * Reallocations happen every ChunkSize adds.
+     * @tparam ChunkSize Amount of elements added to the capacity at once.
+     */
+    template <size_t ChunkSize>
+    class ChunkGrowth
+    {
+        static_assert(ChunkSize > 0, "ChunkSize have to be greater than zero");
+
+    public:
+        static size_t nextCapacity(size_t currentCapacity, size_t minimumCapacity)
+        {
+            size_t newCapacity = currentCapacity + ChunkSize;
+            return newCapacity < minimumCapacity ? minimumCapacity : newCapacity;
+        }
+    };
+
+
+    /**
+     * @brief Multiply capacity by Numerator/Denominator every time when full.
+     * Gives amortized O(1) add().
+     * @tparam Numerator Growth factor numerator.
+     * @tparam Denominator Growth factor denominator.
+     * @tparam MinimumCapacity Capacity allocated when container was empty.
+     */
+    template <size_t Numerator, size_t Denominator, size_t MinimumCapacity = 4>
+    class GeometricGrowth
+    {
+        static_assert(Denominator > 0, "Denominator have to be greater than zero");
+        static_assert(Numerator > Denominator, "Growth factor have to be greater than one");
+
+    public:
+        static size_t nextCapacity(size_t currentCapacity, size_t minimumCapacity)
+        {
+            size_t newCapacity = currentCapacity / Denominator * Numerator
+                + currentCapacity % Denominator * Numerator / Denominator;
+
+            if (newCapacity < MinimumCapacity)
+                newCapacity = MinimumCapacity;
+
+            return newCapacity < minimumCapacity ? minimumCapacity : newCapacity;
+        }
+    };
+
+
+    /**
+     * @brief Capacity is doubled every time when full (default policy).
+     */
+    using DoublingGrowth = GeometricGrowth<2, 1>;
+
+    /**
+     * @brief Capacity is multiplied by 1.5 every time when full.
+     * Wastes less memory than DoublingGrowth.
+     */
+    using OneAndHalfGrowth = GeometricGrowth<3, 2>;
+}
+
+
+#endif
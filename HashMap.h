@@ -0,0 +1,561 @@
+/**
+ * @file HashMap.h
+ * @author Jan Wielgus
+ * @brief Hash maps with open addressing (Robin Hood hashing):
+ * HashMap that grows when needed and StaticHashMap that never allocates.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include "IMap.h"
+#include <functional>
+#include <new>
+#include <utility>
+#include <stdint.h>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Common part of hash maps. Keys and values are stored directly
+     * in one array of slots (no allocation per element).
+     * Every slot remembers how far it is from its home slot. Inserted element
+     * takes the place of the element that is closer to its home ("robs the rich"),
+     * so probe lengths are short and lookup of the missing key can stop early.
+     * Removed element is filled by shifting back the following elements (no tombstones).
+     * Doesn't own the slots array.
+     * @tparam K Type of keys (have to be comparable by ==).
+     * @tparam V Type of values.
+     * @tparam Hash Functor that returns size_t hash of the key.
+     */
+    template <class K, class V, class Hash>
+    class HashTable : public IMap<K, V>
+    {
+    protected:
+        struct Entry
+        {
+            K key;
+            V value;
+        };
+
+        struct Slot
+        {
+            uint32_t distance = 0; // 0 if slot is empty, otherwise 1 + distance from the home slot
+            union
+            {
+                Entry entry; // constructed only if distance > 0
+            };
+
+            Slot() {}
+            ~Slot() {}
+        };
+
+        Slot* slots = nullptr;
+        size_t tableSize = 0; // power of two (at least 8) or 0
+        uint8_t indexShift = 64; // 64 - log2(tableSize)
+        size_t elementsAmount = 0;
+        Hash hash;
+
+
+    public:
+        HashTable(const HashTable& other) = delete;
+        HashTable& operator=(const HashTable& other) = delete;
+
+
+        bool insert(const K& key, const V& value) override
+        {
+            if (findIndex(key) != npos)
+                return false;
+
+            return insertNew(key, value);
+        }
+
+
+        bool set(const K& key, const V& value) override
+        {
+            size_t index = findIndex(key);
+            if (index != npos)
+            {
+                slots[index].entry.value = value;
+                return true;
+            }
+
+            return insertNew(key, value);
+        }
+
+
+        bool erase(const K& key) override
+        {
+            size_t index = findIndex(key);
+            if (index == npos)
+                return false;
+
+            slots[index].entry.~Entry();
+
+            // shift back following elements that are not in their home slot
+            size_t next = nextIndex(index);
+            while (slots[next].distance > 1)
+            {
+                new (&slots[index].entry) Entry(std::move(slots[next].entry));
+                slots[index].distance = slots[next].distance - 1;
+                slots[next].entry.~Entry();
+
+                index = next;
+                next = nextIndex(next);
+            }
+
+            slots[index].distance = 0;
+            elementsAmount--;
+            return true;
+        }
+
+
+        V* find(const K& key) override
+        {
+            size_t index = findIndex(key);
+            return index == npos ? nullptr : &slots[index].entry.value;
+        }
+
+
+        const V* find(const K& key) const override
+        {
+            size_t index = findIndex(key);
+            return index == npos ? nullptr : &slots[index].entry.value;
+        }
+
+
+        bool contains(const K& key) const override
+        {
+            return findIndex(key) != npos;
+        }
+
+
+        size_t size() const override
+        {
+            return elementsAmount;
+        }
+
+
+        bool isEmpty() const override
+        {
+            return elementsAmount == 0;
+        }
+
+
+        void clear() override
+        {
+            destroyEntries();
+        }
+
+
+        /**
+         * @brief Call function(key, value) for every element (in unspecified order).
+         * Map shouldn't be modified inside the function (values can be).
+         */
+        template <class Function>
+        void forEach(Function function)
+        {
+            for (size_t i = 0; i < tableSize; i++)
+                if (slots[i].distance > 0)
+                    function((const K&)slots[i].entry.key, slots[i].entry.value);
+        }
+
+
+        template <class Function>
+        void forEach(Function function) const
+        {
+            for (size_t i = 0; i < tableSize; i++)
+                if (slots[i].distance > 0)
+                    function((const K&)slots[i].entry.key, (const V&)slots[i].entry.value);
+        }
+
+
+    protected:
+        static const size_t npos = (size_t)-1;
+
+
+        HashTable(const Hash& hash)
+            : hash(hash)
+        {
+        }
+
+
+        ~HashTable()
+        {
+        }
+
+
+        /**
+         * @brief Set the slots array (all slots have to be empty).
+         * @param newSlots Array of newTableSize slots.
+         * @param newTableSize Power of two, at least 8.
+         */
+        void setSlots(Slot* newSlots, size_t newTableSize)
+        {
+            slots = newSlots;
+            tableSize = newTableSize;
+
+            indexShift = 64;
+            for (size_t size = newTableSize; size > 1; size >>= 1)
+                indexShift--;
+        }
+
+
+        /**
+         * @brief Make place for one more element (grow the table if needed).
+         * @return false if there is no place.
+         */
+        virtual bool makePlaceForOneMore() = 0;
+
+
+        /**
+         * @return Max amount of elements in the table of tableSize slots
+         * (load factor 7/8, there is always at least one empty slot).
+         */
+        static size_t maxElementsFor(size_t tableSize)
+        {
+            return tableSize - tableSize / 8;
+        }
+
+
+        /**
+         * @brief Move all elements from the old slots array to the current (empty) one.
+         * Old entries are destroyed, old array is not released.
+         */
+        void moveEntriesFrom(Slot* oldSlots, size_t oldTableSize)
+        {
+            for (size_t i = 0; i < oldTableSize; i++)
+            {
+                if (oldSlots[i].distance > 0)
+                {
+                    placeEntry(std::move(oldSlots[i].entry));
+                    oldSlots[i].entry.~Entry();
+                    oldSlots[i].distance = 0;
+                }
+            }
+        }
+
+
+        /**
+         * @brief Copy all elements from the other table (this table has to be empty and big enough).
+         */
+        void copyEntriesFrom(const HashTable& other)
+        {
+            for (size_t i = 0; i < other.tableSize; i++)
+                if (other.slots[i].distance > 0)
+                    placeEntry(Entry(other.slots[i].entry));
+        }
+
+
+        void destroyEntries()
+        {
+            for (size_t i = 0; i < tableSize; i++)
+            {
+                if (slots[i].distance > 0)
+                {
+                    slots[i].entry.~Entry();
+                    slots[i].distance = 0;
+                }
+            }
+
+            elementsAmount = 0;
+        }
+
+
+    private:
+        /**
+         * @brief Home slot of the key (fibonacci hashing spreads also poor hashes, like identity of integers).
+         */
+        size_t homeIndex(const K& key) const
+        {
+            uint64_t keyHash = (uint64_t)hash(key);
+            return (size_t)((keyHash * 11400714819323198485ull) >> indexShift);
+        }
+
+
+        size_t nextIndex(size_t index) const
+        {
+            return (index + 1) & (tableSize - 1);
+        }
+
+
+        size_t findIndex(const K& key) const
+        {
+            if (elementsAmount == 0)
+                return npos;
+
+            size_t index = homeIndex(key);
+            for (uint32_t distance = 1; distance <= slots[index].distance; distance++)
+            {
+                if (slots[index].distance == distance && slots[index].entry.key == key)
+                    return index;
+
+                index = nextIndex(index);
+            }
+
+            // found an empty slot or element closer to its home (key would be placed before it)
+            return npos;
+        }
+
+
+        bool insertNew(const K& key, const V& value)
+        {
+            // key and value can reference an entry of this table, so they are
+            // copied before the table is rehashed by makePlaceForOneMore()
+            Entry newEntry{ key, value };
+            if (!makePlaceForOneMore())
+                return false;
+
+            placeEntry(std::move(newEntry));
+            return true;
+        }
+
+
+        /**
+         * @brief Robin Hood insertion of the key that is not in the table.
+         * There has to be at least one empty slot.
+         */
+        void placeEntry(Entry&& newEntry)
+        {
+            Entry carried(std::move(newEntry));
+            size_t index = homeIndex(carried.key);
+            uint32_t distance = 1;
+
+            while (slots[index].distance > 0)
+            {
+                if (slots[index].distance < distance)
+                {
+                    // element here is closer to its home, take its place and carry it further
+                    std::swap(carried, slots[index].entry);
+                    std::swap(distance, slots[index].distance);
+                }
+
+                index = nextIndex(index);
+                distance++;
+            }
+
+            new (&slots[index].entry) Entry(std::move(carried));
+            slots[index].distance = distance;
+            elementsAmount++;
+        }
+    };
+
+
+
+    /**
+     * @brief Hash map that grows (doubles the slots array) when it is 7/8 full.
+     * @tparam K Type of keys (have to be comparable by ==).
+     * @tparam V Type of values.
+     * @tparam Hash Functor that returns size_t hash of the key.
+     */
+    template <class K, class V, class Hash = std::hash<K>>
+    class HashMap : public HashTable<K, V, Hash>
+    {
+        typedef HashTable<K, V, Hash> Table;
+        typedef typename Table::Slot Slot;
+
+        using Table::slots;
+        using Table::tableSize;
+        using Table::elementsAmount;
+
+
+    public:
+        /**
+         * @brief Construct a new HashMap object.
+         * @param initialCapacity Amount of elements that can be added without reallocation.
+         */
+        explicit HashMap(size_t initialCapacity = 0, const Hash& hash = Hash())
+            : Table(hash)
+        {
+            reserve(initialCapacity);
+        }
+
+
+        HashMap(const HashMap& other)
+            : Table(other.hash)
+        {
+            reserve(other.elementsAmount);
+            this->copyEntriesFrom(other);
+        }
+
+
+        HashMap(HashMap&& toMove)
+            : Table(toMove.hash)
+        {
+            this->setSlots(toMove.slots, toMove.tableSize);
+            elementsAmount = toMove.elementsAmount;
+
+            toMove.setSlots(nullptr, 0);
+            toMove.elementsAmount = 0;
+        }
+
+
+        ~HashMap()
+        {
+            this->destroyEntries();
+            delete[] slots;
+        }
+
+
+        HashMap& operator=(const HashMap& other)
+        {
+            if (this != &other)
+            {
+                this->destroyEntries();
+                this->hash = other.hash;
+                reserve(other.elementsAmount);
+                this->copyEntriesFrom(other);
+            }
+
+            return *this;
+        }
+
+
+        HashMap& operator=(HashMap&& toMove)
+        {
+            if (this != &toMove)
+            {
+                this->destroyEntries();
+                delete[] slots;
+
+                this->hash = toMove.hash;
+                this->setSlots(toMove.slots, toMove.tableSize);
+                elementsAmount = toMove.elementsAmount;
+
+                toMove.setSlots(nullptr, 0);
+                toMove.elementsAmount = 0;
+            }
+
+            return *this;
+        }
+
+
+        /**
+         * @brief Make place for at least capacity elements (rehash if needed).
+         */
+        void reserve(size_t capacity)
+        {
+            if (capacity == 0 || capacity <= Table::maxElementsFor(tableSize))
+                return;
+
+            size_t newTableSize = 8;
+            while (Table::maxElementsFor(newTableSize) < capacity)
+                newTableSize <<= 1;
+
+            rehash(newTableSize);
+        }
+
+
+        /**
+         * @return Amount of elements that can be stored without reallocation.
+         */
+        size_t getCapacity() const
+        {
+            return Table::maxElementsFor(tableSize);
+        }
+
+
+    protected:
+        bool makePlaceForOneMore() override
+        {
+            if (elementsAmount < Table::maxElementsFor(tableSize))
+                return true;
+
+            rehash(tableSize == 0 ? 8 : tableSize * 2);
+            return true;
+        }
+
+
+    private:
+        void rehash(size_t newTableSize)
+        {
+            Slot* oldSlots = slots;
+            size_t oldTableSize = tableSize;
+
+            this->setSlots(new Slot[newTableSize], newTableSize);
+            elementsAmount = 0;
+            this->moveEntriesFrom(oldSlots, oldTableSize);
+
+            delete[] oldSlots;
+        }
+    };
+
+
+
+    /**
+     * @brief Hash map with slots stored inside the object (never allocates).
+     * @tparam K Type of keys (have to be comparable by ==).
+     * @tparam V Type of values.
+     * @tparam Capacity Max amount of elements.
+     * @tparam Hash Functor that returns size_t hash of the key.
+     */
+    template <class K, class V, size_t Capacity, class Hash = std::hash<K>>
+    class StaticHashMap : public HashTable<K, V, Hash>
+    {
+        typedef HashTable<K, V, Hash> Table;
+        typedef typename Table::Slot Slot;
+
+        // the smallest power of two that keeps the load factor under 7/8
+        static constexpr size_t computeTableSize(size_t size = 8)
+        {
+            return size - size / 8 >= Capacity ? size : computeTableSize(size * 2);
+        }
+
+        static constexpr size_t TableSize = computeTableSize();
+
+        Slot slotsStorage[TableSize];
+
+
+    public:
+        explicit StaticHashMap(const Hash& hash = Hash())
+            : Table(hash)
+        {
+            this->setSlots(slotsStorage, TableSize);
+        }
+
+
+        StaticHashMap(const StaticHashMap& other)
+            : StaticHashMap(other.hash)
+        {
+            this->copyEntriesFrom(other);
+        }
+
+
+        ~StaticHashMap()
+        {
+            this->destroyEntries();
+        }
+
+
+        StaticHashMap& operator=(const StaticHashMap& other)
+        {
+            if (this != &other)
+            {
+                this->destroyEntries();
+                this->hash = other.hash;
+                this->copyEntriesFrom(other);
+            }
+
+            return *this;
+        }
+
+
+        static constexpr size_t getCapacity()
+        {
+            return Capacity;
+        }
+
+
+    protected:
+        bool makePlaceForOneMore() override
+        {
+            return this->elementsAmount < Capacity;
+        }
+    };
+}
+
+
+#endif
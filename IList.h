@@ -43,6 +43,23 @@ namespace SimpleDataStructures
          */
         virtual bool add(const T& item, size_t index) = 0;
 
+        /**
+         * @brief Adds new item to the array by moving it (without a deep copy).
+         * @param item Item to be moved to the array
+         * @return false if item was not added (for example because list is full)
+         */
+        virtual bool add(T&& item) = 0;
+
+        /**
+         * @brief Adds new item to the array at the specified index by moving it.
+         * Do not remove any items from the array.
+         * @param item Item to be moved to the array
+         * @param index Index where to add new item
+         * (following items will be moved one place forward)
+         * @return false if item was not added (for example because list is full)
+         */
+        virtual bool add(T&& item, size_t index) = 0;
+
         /**
          * @brief Removes element from the specified index.
          * @param index Index of the element to remove.
@@ -83,6 +100,15 @@ namespace SimpleDataStructures
          */
         virtual bool replace(const T& newItem, size_t index) = 0;
 
+        /**
+         * @brief Replace item at the specified index with another item
+         * by moving it (without a deep copy).
+         * @param newItem New item that will be moved to the index
+         * @param index Index of the item to be replaced
+         * @return false if index is out of bounds or just something bad happened
+         */
+        virtual bool replace(T&& newItem, size_t index) = 0;
+
         /**
          * @brief Get index of the first occurence of itemToFind
          * or npos if an item was not found.
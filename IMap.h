@@ -0,0 +1,77 @@
+/**
+ * @file IMap.h
+ * @author Jan Wielgus
+ * @brief Common interface for associative containers (key -> value).
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef IMAP_H
+#define IMAP_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+
+
+namespace SimpleDataStructures
+{
+    template <class K, class V>
+    class IMap
+    {
+    public:
+        virtual ~IMap() {}
+
+        /**
+         * @brief Adds new key with value. Don't change value of the existing key.
+         * @return false if key already exists or map is full.
+         */
+        virtual bool insert(const K& key, const V& value) = 0;
+
+        /**
+         * @brief Adds new key with value or change value of the existing key.
+         * @return false if map is full.
+         */
+        virtual bool set(const K& key, const V& value) = 0;
+
+        /**
+         * @brief Removes the key and its value.
+         * @return false if there was no such key.
+         */
+        virtual bool erase(const K& key) = 0;
+
+        /**
+         * @return Pointer to the value of the key or nullptr if there is no such key.
+         * Valid until the next modification of the map.
+         */
+        virtual V* find(const K& key) = 0;
+
+        /**
+         * @return Pointer to the value of the key or nullptr if there is no such key.
+         */
+        virtual const V* find(const K& key) const = 0;
+
+        /**
+         * @return true if map contains the key.
+         */
+        virtual bool contains(const K& key) const = 0;
+
+        /**
+         * @return Amount of keys in the map.
+         */
+        virtual size_t size() const = 0;
+
+        /**
+         * @return true if map is empty.
+         */
+        virtual bool isEmpty() const = 0;
+
+        /**
+         * @brief Removes all keys.
+         */
+        virtual void clear() = 0;
+    };
+}
+
+
+#endif
@@ -2,6 +2,7 @@
  * @file LinkedList.h
  * @author Jan Wielgus
  * @brief One-way, dynamically allocated linked list class.
+ * Nodes are allocated by the node allocator (heap by default, see NodeAllocators.h).
  * @date 2020-09-01
  * 
  */
@@ -9,7 +10,11 @@
 #ifndef LINKEDLIST_H
 #define LINKEDLIST_H
 
-#include "IList.h"
+#include "StaticInterfaces.h"
+#include "NodeAllocators.h"
+#include "StlIterators.h"
+#include <type_traits>
+#include <utility>
 
 
 namespace SimpleDataStructures
@@ -30,12 +35,29 @@ namespace SimpleDataStructures
             : data(_data), next(_next)
         {
         }
+
+        Node(T&& _data, Node<T>* _next = nullptr)
+            : data(std::move(_data)), next(_next)
+        {
+        }
+
+        /**
+         * @brief Construct data in place from the args.
+         */
+        template <class... Args>
+        explicit Node(Node<T>* _next, Args&&... args)
+            : data(std::forward<Args>(args)...), next(_next)
+        {
+        }
     };
 
 
 
-    template <class T>
-    class LinkedList;
+    template <class T, class NodeAllocator = HeapNodeAllocator<Node<T>>>
+    class PlainLinkedList;
+
+    template <class T, class NodeAllocator = HeapNodeAllocator<Node<T>>>
+    class LinkedListRemovingIterator;
 
 
 
@@ -51,7 +73,8 @@ namespace SimpleDataStructures
         T nullElement;
 
     public:
-        LinkedListIterator(const LinkedList<T>& linkedList);
+        template <class NodeAllocator>
+        LinkedListIterator(const PlainLinkedList<T, NodeAllocator>& linkedList);
 
         LinkedListIterator(const LinkedListIterator&) = delete;
         LinkedListIterator& operator=(const LinkedListIterator&) = delete;
@@ -115,15 +138,28 @@ namespace SimpleDataStructures
         /**
          * @brief Resets the iterator.
          */
-        void reset(const LinkedList<T>& linkedList);
+        template <class NodeAllocator>
+        void reset(const PlainLinkedList<T, NodeAllocator>& linkedList);
     };
 
 
 
 
-    template <class T>
-    class LinkedList : public IList<T>
+    /**
+     * @brief One-way linked list.
+     * @tparam T Type of stored elements.
+     * @tparam NodeAllocator Allocator of Node<T> objects (see NodeAllocators.h).
+     * HeapNodeAllocator (default) use new/delete for every node,
+     * PoolNodeAllocator and StaticNodePool recycle nodes, so list churn
+     * don't cause any heap calls.
+     * This version has no virtual methods (implements the static ListInterface),
+     * use LinkedList if the IList interface is needed.
+     */
+    template <class T, class NodeAllocator>
+    class PlainLinkedList : public ListInterface<PlainLinkedList<T, NodeAllocator>, T>
     {
+        NodeAllocator nodeAllocator;
+
         Node<T>* root = nullptr;
         Node<T>* tail = nullptr;
         size_t linkedListSize = 0;
@@ -134,38 +170,32 @@ namespace SimpleDataStructures
         T nullElement; // element returned for example when used get() on empty list
 
         friend class LinkedListIterator<T>;
+        friend class LinkedListRemovingIterator<T, NodeAllocator>;
 
 
     public:
-        LinkedList() {}
+        PlainLinkedList() {}
 
 
-        LinkedList(const LinkedList& other)
+        PlainLinkedList(const PlainLinkedList& other)
         {
             setFrom(other);
         }
 
 
-        LinkedList(LinkedList&& toMove)
+        PlainLinkedList(PlainLinkedList&& toMove)
         {
-            root = toMove.root;
-            tail = toMove.tail;
-            linkedListSize = toMove.linkedListSize;
-
-            toMove.root = nullptr;
-            toMove.tail = nullptr;
-            toMove.linkedListSize = 0;
-            toMove.cachedNode = nullptr;
+            takeNodesFrom(toMove);
         }
 
 
-        ~LinkedList()
+        ~PlainLinkedList()
         {
             clear();
         }
         
 
-        LinkedList& operator=(const LinkedList& other)
+        PlainLinkedList& operator=(const PlainLinkedList& other)
         {
             if (this != &other)
                 setFrom(other);
@@ -174,36 +204,62 @@ namespace SimpleDataStructures
         }
 
 
-        LinkedList& operator=(LinkedList&& toMove)
+        PlainLinkedList& operator=(PlainLinkedList&& toMove)
         {
             if (this != &toMove)
             {
                 clear();
-
-                root = toMove.root;
-                tail = toMove.tail;
-                linkedListSize = toMove.linkedListSize;
-
-                toMove.root = nullptr;
-                toMove.tail = nullptr;
-                toMove.linkedListSize = 0;
-                toMove.cachedNode = nullptr;
+                takeNodesFrom(toMove);
             }
 
             return *this;
         }
 
 
-        bool add(const T& item) override
+        bool add(const T& item)
+        {
+            return emplace(item);
+        }
+
+
+        bool add(T&& item)
+        {
+            return emplace(std::move(item));
+        }
+
+        
+        bool add(const T& item, size_t index)
         {
+            return emplaceAt(index, item);
+        }
+
+
+        bool add(T&& item, size_t index)
+        {
+            return emplaceAt(index, std::move(item));
+        }
+
+
+        /**
+         * @brief Construct new item directly inside a new node at the end of the list.
+         * @param args Arguments passed to the T constructor.
+         * @return false if node allocator has run out of memory.
+         */
+        template <class... Args>
+        bool emplace(Args&&... args)
+        {
+            Node<T>* newNode = nodeAllocator.create(nullptr, std::forward<Args>(args)...);
+            if (newNode == nullptr)
+                return false;
+
             if (root == nullptr)
             {
-                root = new Node<T>(item);
+                root = newNode;
                 tail = root;
             }
             else
             {
-                tail->next = new Node<T>(item);
+                tail->next = newNode;
                 tail = tail->next;
             }
             
@@ -213,16 +269,25 @@ namespace SimpleDataStructures
             return true;
         }
 
-        
-        bool add(const T& item, size_t index) override
+
+        /**
+         * @brief Construct new item directly inside a new node at the specified index.
+         * @param index Index where to construct new item.
+         * @param args Arguments passed to the T constructor.
+         * @return false if index is out of bounds or node allocator has run out of memory.
+         */
+        template <class... Args>
+        bool emplaceAt(size_t index, Args&&... args)
         {
             if (index > linkedListSize)
                 return false;
 
             if (root == nullptr || index == linkedListSize)
-                return add(item);
+                return emplace(std::forward<Args>(args)...);
 
-            Node<T>* newNode = new Node<T>(item);
+            Node<T>* newNode = nodeAllocator.create(nullptr, std::forward<Args>(args)...);
+            if (newNode == nullptr)
+                return false;
 
             if (index == 0)
             {
@@ -250,7 +315,7 @@ namespace SimpleDataStructures
          * @return true if element was removed. Return false if list is empty
          * or index is out of bounds.
          */
-        bool remove(size_t index) override
+        bool remove(size_t index)
         {
             if (root == nullptr || index >= linkedListSize)
                 return false;
@@ -275,7 +340,7 @@ namespace SimpleDataStructures
                     tail = preceding;
             }
             
-            delete toDelete;
+            nodeAllocator.destroy(toDelete);
             linkedListSize--;
             cachedNode = nullptr;
 
@@ -283,35 +348,35 @@ namespace SimpleDataStructures
         }
 
         
-        T& get(size_t index) override
+        T& get(size_t index)
         {
             Node<T>* toReturn = getNode(index);
             return toReturn == nullptr ? nullElement : toReturn->data;
         }
 
         
-        const T& get(size_t index) const override
+        const T& get(size_t index) const
         {
             Node<T>* toReturn = getNode(index);
             return toReturn == nullptr ? nullElement : toReturn->data;
         }
 
         
-        T& operator[](size_t index) override
+        T& operator[](size_t index)
         {
             Node<T>* toReturn = getNode(index);
             return toReturn == nullptr ? nullElement : toReturn->data;
         }
 
         
-        const T& operator[](size_t index) const override
+        const T& operator[](size_t index) const
         {
             Node<T>* toReturn = getNode(index);
             return toReturn == nullptr ? nullElement : toReturn->data;
         }
 
         
-        bool replace(const T& newItem, size_t index) override
+        bool replace(const T& newItem, size_t index)
         {
             Node<T>* toReplace = getNode(index);
             
@@ -323,7 +388,19 @@ namespace SimpleDataStructures
         }
 
 
-        size_t find(const T& itemToFind, size_t startIndex = 0) const override
+        bool replace(T&& newItem, size_t index)
+        {
+            Node<T>* toReplace = getNode(index);
+            
+            if (toReplace == nullptr)
+                return false;
+            
+            toReplace->data = std::move(newItem);
+            return true;
+        }
+
+
+        size_t find(const T& itemToFind, size_t startIndex = 0) const
         {
             Node<T>* startNode = getNode(startIndex);
 
@@ -343,7 +420,7 @@ namespace SimpleDataStructures
         }
 
 
-        bool contains(const T& itemToFind) const override
+        bool contains(const T& itemToFind) const
         {
             for (Node<T>* node = root; node != nullptr; node = node->next)
                 if (node->data == itemToFind)
@@ -353,19 +430,107 @@ namespace SimpleDataStructures
         }
 
         
-        size_t size() const override
+        size_t size() const
         {
             return linkedListSize;
         }
 
+
+        /**
+         * @brief Iterators for the range-based for loop and STL algorithms (forward).
+         * Faster than LinkedListIterator (no virtual calls).
+         */
+        NodeWalker<T, Node<T>> begin()
+        {
+            return NodeWalker<T, Node<T>>(root);
+        }
+
+
+        NodeWalker<T, Node<T>> end()
+        {
+            return NodeWalker<T, Node<T>>(nullptr);
+        }
+
+
+        NodeWalker<const T, const Node<T>> begin() const
+        {
+            return NodeWalker<const T, const Node<T>>(root);
+        }
+
+
+        NodeWalker<const T, const Node<T>> end() const
+        {
+            return NodeWalker<const T, const Node<T>>(nullptr);
+        }
+
+
+        /**
+         * @brief Call function(element) for every element (from the first one).
+         * Nodes are followed directly, without virtual calls and cached node updates like get().
+         */
+        template <class Function>
+        void forEach(Function&& function)
+        {
+            for (Node<T>* node = root; node != nullptr; node = node->next)
+                function(node->data);
+        }
+
+
+        template <class Function>
+        void forEach(Function&& function) const
+        {
+            for (const Node<T>* node = root; node != nullptr; node = node->next)
+                function((const T&)node->data);
+        }
+
+
+        /**
+         * @brief Fold all elements: result = function(result, element), starting with init.
+         * @return Final result.
+         */
+        template <class Result, class Function>
+        Result reduce(Result init, Function&& function) const
+        {
+            for (const Node<T>* node = root; node != nullptr; node = node->next)
+                init = function(init, (const T&)node->data);
+
+            return init;
+        }
+
+
+        /**
+         * @brief Replace every element with function(element).
+         */
+        template <class Function>
+        void transformInPlace(Function&& function)
+        {
+            for (Node<T>* node = root; node != nullptr; node = node->next)
+                node->data = function(node->data);
+        }
+
+
+        /**
+         * @return Amount of elements for which predicate(element) is true.
+         */
+        template <class Predicate>
+        size_t countIf(Predicate&& predicate) const
+        {
+            size_t count = 0;
+            for (const Node<T>* node = root; node != nullptr; node = node->next)
+                if (predicate((const T&)node->data))
+                    count++;
+
+            return count;
+        }
+
         
-        bool isEmpty() const override
+        bool isEmpty() const
         {
             return root == nullptr;
         }
 
 
-        void clear() override
+        void clear()
         {
             deleteFromNode(root);
             root = nullptr;
@@ -375,6 +540,16 @@ namespace SimpleDataStructures
         }
 
 
+        /**
+         * @brief Gives access to the node allocator,
+         * for example to preallocate nodes of the PoolNodeAllocator.
+         */
+        NodeAllocator& getNodeAllocator()
+        {
+            return nodeAllocator;
+        }
+
+
 
     private:
         Node<T>* getNode(size_t index) const
@@ -402,8 +577,8 @@ namespace SimpleDataStructures
             }
 
             // Store new cached node
-            const_cast<LinkedList*>(this)->cachedNode = startNode;
-            const_cast<LinkedList*>(this)->cachedNodeIndex = index;
+            const_cast<PlainLinkedList*>(this)->cachedNode = startNode;
+            const_cast<PlainLinkedList*>(this)->cachedNodeIndex = index;
             
             return startNode;
         }
@@ -427,35 +602,38 @@ namespace SimpleDataStructures
         }
 
 
-        bool removeNode(const Node<T>* nodeToRemove)
+        bool removeNode(Node<T>* nodeToRemove)
         {
             if (root == nullptr || nodeToRemove == nullptr)
                 return false;
-            
-            if (nodeToRemove == root)
-            {
-                root = root->next;
-                
-                if (root == nullptr)
-                    tail = nullptr;
-            }
+
+            Node<T>* precedingNode = getPrecedingNode(nodeToRemove);
+            if (nodeToRemove != root && precedingNode == nullptr) // node was not found
+                return false;
+
+            removeNode(nodeToRemove, precedingNode);
+            return true;
+        }
+
+
+        /**
+         * @brief Remove node in O(1) time when its predecessor is known.
+         * @param nodeToRemove Node of this list to remove.
+         * @param precedingNode Node before nodeToRemove (nullptr if nodeToRemove is root).
+         */
+        void removeNode(Node<T>* nodeToRemove, Node<T>* precedingNode)
+        {
+            if (precedingNode == nullptr)
+                root = nodeToRemove->next;
             else
-            {
-                Node<T>* precedingNode = getPrecedingNode(nodeToRemove);
-                if (precedingNode == nullptr) // node was not found
-                    return false;
-                
                 precedingNode->next = nodeToRemove->next;
 
-                if (nodeToRemove->next == nullptr) // if this was a tail node
-                    tail = precedingNode;
-            }
-            
-            delete nodeToRemove;
+            if (nodeToRemove == tail)
+                tail = precedingNode;
+
+            nodeAllocator.destroy(nodeToRemove);
             linkedListSize--;
             cachedNode = nullptr;
-
-            return true;
         }
 
 
@@ -469,7 +647,7 @@ namespace SimpleDataStructures
             while (nodeToDel != nullptr)
             {
                 Node<T>* next = nodeToDel->next;
-                delete nodeToDel;
+                nodeAllocator.destroy(nodeToDel);
                 nodeToDel = next;
             }
 
@@ -478,10 +656,12 @@ namespace SimpleDataStructures
 
 
         /**
-         * @brief Clear LinkedList and make a deep copy of data from other.
-         * @param other LinkedList to make a deep copy.
+         * @brief Clear PlainLinkedList and make a deep copy of data from other.
+         * Existing nodes are reused. If node allocator run out of memory,
+         * only the beginning of other list is copied.
+         * @param other PlainLinkedList to make a deep copy.
          */
-        void setFrom(const LinkedList& other)
+        void setFrom(const PlainLinkedList& other)
         {
             if (other.linkedListSize == 0)
             {
@@ -491,25 +671,38 @@ namespace SimpleDataStructures
 
 
             if (root == nullptr)
-                root = new Node<T>();
-
-            root->data = other.root->data;
+            {
+                root = nodeAllocator.create(nullptr, other.root->data);
+                if (root == nullptr)
+                {
+                    clear();
+                    return;
+                }
+            }
+            else
+                root->data = other.root->data;
 
             Node<T>* lastSrcNode = other.root;
             Node<T>* lastDestNode = root;
+            size_t copiedElements = 1;
 
             // copy all data
             while (lastSrcNode->next != nullptr)
             {
                 // if node doesn't exist, allocate memory for a new node
                 if (lastDestNode->next == nullptr)
-                    lastDestNode->next = new Node<T>();
-
-                lastDestNode->next->data = lastSrcNode->next->data;
+                {
+                    lastDestNode->next = nodeAllocator.create(nullptr, lastSrcNode->next->data);
+                    if (lastDestNode->next == nullptr)
+                        break;
+                }
+                else
+                    lastDestNode->next->data = lastSrcNode->next->data;
 
                 // move to next nodes
                 lastSrcNode = lastSrcNode->next;
                 lastDestNode = lastDestNode->next;
+                copiedElements++;
             }
 
             // delete remaining nodes if this linked list was bigger than copied one
@@ -518,27 +711,190 @@ namespace SimpleDataStructures
             tail = lastDestNode;
             tail->next = nullptr;
 
-            linkedListSize = other.linkedListSize;
+            linkedListSize = copiedElements;
 
             cachedNode = nullptr;
         }
+
+
+        /**
+         * @brief Move all elements from the other (empty this list first).
+         * If nodes can be transferred between allocators, only pointers are taken,
+         * otherwise elements are moved one by one to the new nodes.
+         * @param toMove PlainLinkedList to take elements from. Will be empty after that.
+         */
+        void takeNodesFrom(PlainLinkedList& toMove)
+        {
+            takeNodesFrom(toMove, std::integral_constant<bool, NodeAllocator::CanTransferNodes>());
+        }
+
+
+        void takeNodesFrom(PlainLinkedList& toMove, std::true_type /* canTransferNodes */)
+        {
+            nodeAllocator.swap(toMove.nodeAllocator);
+
+            root = toMove.root;
+            tail = toMove.tail;
+            linkedListSize = toMove.linkedListSize;
+
+            toMove.root = nullptr;
+            toMove.tail = nullptr;
+            toMove.linkedListSize = 0;
+            toMove.cachedNode = nullptr;
+        }
+
+
+        void takeNodesFrom(PlainLinkedList& toMove, std::false_type /* canTransferNodes */)
+        {
+            for (Node<T>* node = toMove.root; node != nullptr; node = node->next)
+                emplace(std::move(node->data));
+
+            toMove.clear();
+        }
     };
 
 
 
 
     template <class T>
-    LinkedListIterator<T>::LinkedListIterator(const LinkedList<T>& linkedList)
+    template <class NodeAllocator>
+    LinkedListIterator<T>::LinkedListIterator(const PlainLinkedList<T, NodeAllocator>& linkedList)
     {
         nextNode = linkedList.root;
     }
 
 
     template <class T>
-    void LinkedListIterator<T>::reset(const LinkedList<T>& linkedList)
+    template <class NodeAllocator>
+    void LinkedListIterator<T>::reset(const PlainLinkedList<T, NodeAllocator>& linkedList)
     {
-        nextNode = nullptr;
+        nextNode = linkedList.root;
     }
+
+
+
+
+    /**
+     * @brief Iterator for the LinkedList that can remove elements.
+     * Remembers the node before the last returned one, so both next()
+     * and remove() are O(1) (unlike ListIterator, which removes by index).
+     * List shouldn't be modified by other means during iteration.
+     */
+    template <class T, class NodeAllocator>
+    class LinkedListRemovingIterator : public RemovingIterator<T>
+    {
+        PlainLinkedList<T, NodeAllocator>* list = nullptr;
+        Node<T>* precedingNode = nullptr; // node before the last returned one (nullptr if it is root)
+        Node<T>* lastReturnedNode = nullptr;
+        Node<T>* nextNode = nullptr;
+        T nullElement;
+
+    public:
+        LinkedListRemovingIterator(PlainLinkedList<T, NodeAllocator>& list)
+        {
+            reset(list);
+        }
+
+        LinkedListRemovingIterator(const LinkedListRemovingIterator&) = delete;
+        LinkedListRemovingIterator& operator=(const LinkedListRemovingIterator&) = delete;
+
+
+        LinkedListRemovingIterator(LinkedListRemovingIterator&& toMove)
+        {
+            *this = std::move(toMove);
+        }
+
+
+        LinkedListRemovingIterator& operator=(LinkedListRemovingIterator&& toMove)
+        {
+            if (this != &toMove)
+            {
+                list = toMove.list;
+                precedingNode = toMove.precedingNode;
+                lastReturnedNode = toMove.lastReturnedNode;
+                nextNode = toMove.nextNode;
+
+                toMove.reset();
+            }
+
+            return *this;
+        }
+
+
+        bool hasNext() override
+        {
+            return nextNode != nullptr;
+        }
+
+
+        T& next() override
+        {
+            if (nextNode == nullptr)
+                return nullElement;
+
+            // removed node is not a predecessor of the next one
+            if (lastReturnedNode != nullptr)
+                precedingNode = lastReturnedNode;
+
+            lastReturnedNode = nextNode;
+            nextNode = nextNode->next;
+            return lastReturnedNode->data;
+        }
+
+
+        /**
+         * @brief Removes the last element returned by next() in O(1) time.
+         */
+        bool remove() override
+        {
+            if (list == nullptr || lastReturnedNode == nullptr)
+                return false;
+
+            list->removeNode(lastReturnedNode, precedingNode);
+            lastReturnedNode = nullptr;
+            return true;
+        }
+
+
+        /**
+         * @brief Iterator won't have next elements from now.
+         */
+        void reset()
+        {
+            list = nullptr;
+            precedingNode = nullptr;
+            lastReturnedNode = nullptr;
+            nextNode = nullptr;
+        }
+
+
+        /**
+         * @brief Sets iterator at the beginning of the passed list.
+         */
+        void reset(PlainLinkedList<T, NodeAllocator>& list)
+        {
+            this->list = &list;
+            precedingNode = nullptr;
+            lastReturnedNode = nullptr;
+            nextNode = list.root;
+        }
+    };
+
+
+
+
+    /**
+     * @brief PlainLinkedList that implements the virtual IList interface
+     * (added by VirtualListAdapter, costs a vtable pointer in the object).
+     */
+    template <class T, class NodeAllocator = HeapNodeAllocator<Node<T>>>
+    class LinkedList : public VirtualListAdapter<PlainLinkedList<T, NodeAllocator>>
+    {
+    public:
+        LinkedList()
+        {
+        }
+    };
 }
 
 
@@ -0,0 +1,204 @@
+/**
+ * @file MpmcQueue.h
+ * @author Jan Wielgus
+ * @brief Bounded lock-free queue for many producer and many consumer threads.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include "CacheLine.h"
+#include <atomic>
+#include <utility>
+#include <stdint.h>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Bounded multi-producer/multi-consumer queue (Dmitry Vyukov's algorithm).
+     * Every slot has a sequence number that tells if it is ready to be written
+     * or read in the current lap, so producers and consumers synchronize only
+     * on one CAS of enqueue/dequeue position and don't block each other.
+     * Has the same methods as IQueue, except dequeue() and peek() that return
+     * a reference (element can be overwritten by other thread at any time),
+     * use tryDequeue() instead.
+     * @tparam T Type of stored elements.
+     */
+    template <class T>
+    class MpmcQueue
+    {
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            T data;
+        };
+
+        const size_t IndexMask; // array size (power of two) - 1
+        Cell* cells = nullptr;
+
+        alignas(CacheLineSize) std::atomic<size_t> enqueuePosition{0};
+        alignas(CacheLineSize) std::atomic<size_t> dequeuePosition{0};
+
+
+    public:
+        /**
+         * @brief Construct a new queue.
+         * @param queueSize Minimum size of the queue. Will be rounded up
+         * to the power of two (at least 2).
+         */
+        explicit MpmcQueue(size_t queueSize)
+            : IndexMask(roundUpToPowerOfTwo(queueSize < 2 ? 2 : queueSize) - 1)
+        {
+            cells = new Cell[IndexMask + 1];
+
+            for (size_t i = 0; i <= IndexMask; i++)
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+
+        ~MpmcQueue()
+        {
+            delete[] cells;
+        }
+
+
+        /**
+         * @brief Adds item to the end of the queue. Can be called from any thread.
+         * @return false if queue is full.
+         */
+        bool tryEnqueue(const T& item)
+        {
+            Cell* cell;
+            size_t position = enqueuePosition.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                cell = &cells[position & IndexMask];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+                if (difference == 0)
+                {
+                    // slot is free in this lap, try to take it
+                    if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (difference < 0)
+                    return false; // slot still holds item from the previous lap (queue is full)
+                else
+                    position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+
+            cell->data = item;
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+
+        /**
+         * @brief The same as tryEnqueue().
+         */
+        bool enqueue(const T& item)
+        {
+            return tryEnqueue(item);
+        }
+
+
+        /**
+         * @brief Removes the first item from the queue. Can be called from any thread.
+         * @param output [out] Place where dequeued item will be moved.
+         * @return false if queue is empty (output is unchanged).
+         */
+        bool tryDequeue(T& output)
+        {
+            Cell* cell;
+            size_t position = dequeuePosition.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                cell = &cells[position & IndexMask];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+
+                if (difference == 0)
+                {
+                    // slot was written in this lap, try to take it
+                    if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (difference < 0)
+                    return false; // slot is not written yet (queue is empty)
+                else
+                    position = dequeuePosition.load(std::memory_order_relaxed);
+            }
+
+            output = std::move(cell->data);
+            cell->sequence.store(position + IndexMask + 1, std::memory_order_release); // free for the next lap
+            return true;
+        }
+
+
+        /**
+         * @brief Removes all elements (by dequeuing them).
+         */
+        void clear()
+        {
+            T item;
+            while (tryDequeue(item))
+                ;
+        }
+
+
+        /**
+         * @return Amount of elements in the queue (may be outdated when other threads are working).
+         */
+        size_t getQueueLength() const
+        {
+            size_t dequeued = dequeuePosition.load(std::memory_order_acquire);
+            size_t enqueued = enqueuePosition.load(std::memory_order_acquire);
+            return enqueued > dequeued ? enqueued - dequeued : 0;
+        }
+
+
+        bool isEmpty() const
+        {
+            return getQueueLength() == 0;
+        }
+
+
+        bool isFull() const
+        {
+            return getQueueLength() >= getCapacity();
+        }
+
+
+        /**
+         * @return Max amount of elements in the queue.
+         */
+        size_t getCapacity() const
+        {
+            return IndexMask + 1;
+        }
+
+
+    private:
+        static size_t roundUpToPowerOfTwo(size_t value)
+        {
+            size_t result = 1;
+            while (result < value)
+                result <<= 1;
+
+            return result;
+        }
+    };
+}
+
+
+#endif
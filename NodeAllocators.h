@@ -0,0 +1,262 @@
+/**
+ * @file NodeAllocators.h
+ * @author Jan Wielgus
+ * @brief Allocators that provide memory for nodes of linked data structures.
+ * All of them have the same interface:
+ * create(args...) - construct a new node (return nullptr if out of memory),
+ * destroy(node) - destruct the node and release its memory,
+ * swap(other) - exchange allocated memory with other allocator
+ * (only if CanTransferNodes is true).
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef NODEALLOCATORS_H
+#define NODEALLOCATORS_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+#include <new>
+#include <utility>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Every node is allocated on the heap with new and released with delete.
+     * @tparam NodeType Type of node to allocate.
+     */
+    template <class NodeType>
+    class HeapNodeAllocator
+    {
+    public:
+        // nodes can be passed to the other allocator of this type after swap()
+        static constexpr bool CanTransferNodes = true;
+
+
+        template <class... Args>
+        NodeType* create(Args&&... args)
+        {
+            return new NodeType(std::forward<Args>(args)...);
+        }
+
+
+        void destroy(NodeType* node)
+        {
+            delete node;
+        }
+
+
+        void swap(HeapNodeAllocator&)
+        {
+        }
+    };
+
+
+
+    /**
+     * @brief Node memory is taken from slabs of SlabSize nodes.
+     * Destroyed nodes are kept on the free list and reused by next create() calls,
+     * so when list size doesn't exceed the peak size, there are no heap calls.
+     * Slabs are released only when allocator is destroyed.
+     * @tparam NodeType Type of node to allocate.
+     * @tparam SlabSize Amount of nodes allocated at once when free list is empty.
+     */
+    template <class NodeType, size_t SlabSize = 16>
+    class PoolNodeAllocator
+    {
+        static_assert(SlabSize > 0, "SlabSize have to be greater than zero");
+
+        union Slot
+        {
+            Slot* nextFree;
+            alignas(NodeType) unsigned char storage[sizeof(NodeType)];
+        };
+
+        struct Slab
+        {
+            Slab* next;
+            Slot slots[SlabSize];
+        };
+
+        Slab* slabs = nullptr;
+        Slot* freeList = nullptr;
+        size_t allocatedNodes = 0; // amount of slots in all slabs
+        bool fixedCapacity = false; // if true, new slabs are not allocated
+
+
+    public:
+        static constexpr bool CanTransferNodes = true;
+
+
+        PoolNodeAllocator() {}
+
+        PoolNodeAllocator(const PoolNodeAllocator&) = delete;
+        PoolNodeAllocator& operator=(const PoolNodeAllocator&) = delete;
+
+
+        /**
+         * @brief Release all slabs. All nodes have to be already destroyed.
+         */
+        ~PoolNodeAllocator()
+        {
+            while (slabs != nullptr)
+            {
+                Slab* next = slabs->next;
+                delete slabs;
+                slabs = next;
+            }
+        }
+
+
+        template <class... Args>
+        NodeType* create(Args&&... args)
+        {
+            if (freeList == nullptr && !addSlab())
+                return nullptr;
+
+            Slot* slot = freeList;
+            freeList = slot->nextFree;
+            return new (slot->storage) NodeType(std::forward<Args>(args)...);
+        }
+
+
+        void destroy(NodeType* node)
+        {
+            node->~NodeType();
+
+            Slot* slot = reinterpret_cast<Slot*>(node);
+            slot->nextFree = freeList;
+            freeList = slot;
+        }
+
+
+        void swap(PoolNodeAllocator& other)
+        {
+            std::swap(slabs, other.slabs);
+            std::swap(freeList, other.freeList);
+            std::swap(allocatedNodes, other.allocatedNodes);
+            std::swap(fixedCapacity, other.fixedCapacity);
+        }
+
+
+        /**
+         * @brief Allocate slabs for at least amount nodes in total.
+         * @param amount Minimum amount of nodes that can be created without heap calls.
+         * @param makeCapacityFixed If true, no more slabs will be allocated later
+         * (create() will return nullptr when all nodes are used).
+         */
+        void preallocate(size_t amount, bool makeCapacityFixed = false)
+        {
+            fixedCapacity = false;
+            while (allocatedNodes < amount)
+                addSlab();
+
+            fixedCapacity = makeCapacityFixed;
+        }
+
+
+        /**
+         * @return Amount of nodes that can be created without allocating a new slab.
+         */
+        size_t capacity() const
+        {
+            return allocatedNodes;
+        }
+
+
+    private:
+        bool addSlab()
+        {
+            if (fixedCapacity)
+                return false;
+
+            Slab* newSlab = new Slab;
+            newSlab->next = slabs;
+            slabs = newSlab;
+
+            for (size_t i = 0; i < SlabSize; i++)
+            {
+                newSlab->slots[i].nextFree = freeList;
+                freeList = &newSlab->slots[i];
+            }
+
+            allocatedNodes += SlabSize;
+            return true;
+        }
+    };
+
+
+
+    /**
+     * @brief Pool of Capacity nodes stored inside the allocator object.
+     * Never uses the heap, create() return nullptr when all nodes are used.
+     * @tparam NodeType Type of node to allocate.
+     * @tparam Capacity Maximum amount of nodes.
+     */
+    template <class NodeType, size_t Capacity>
+    class StaticNodePool
+    {
+        static_assert(Capacity > 0, "Capacity have to be greater than zero");
+
+        union Slot
+        {
+            Slot* nextFree;
+            alignas(NodeType) unsigned char storage[sizeof(NodeType)];
+        };
+
+        Slot slots[Capacity];
+        Slot* freeList = nullptr;
+        size_t usedSlots = 0; // slots from the beginning that were used at least once
+
+
+    public:
+        // nodes are inside this object, they cannot be moved to other allocator
+        static constexpr bool CanTransferNodes = false;
+
+
+        StaticNodePool() {}
+
+        StaticNodePool(const StaticNodePool&) = delete;
+        StaticNodePool& operator=(const StaticNodePool&) = delete;
+
+
+        template <class... Args>
+        NodeType* create(Args&&... args)
+        {
+            Slot* slot;
+
+            if (freeList != nullptr)
+            {
+                slot = freeList;
+                freeList = slot->nextFree;
+            }
+            else if (usedSlots < Capacity)
+                slot = &slots[usedSlots++];
+            else
+                return nullptr;
+
+            return new (slot->storage) NodeType(std::forward<Args>(args)...);
+        }
+
+
+        void destroy(NodeType* node)
+        {
+            node->~NodeType();
+
+            Slot* slot = reinterpret_cast<Slot*>(node);
+            slot->nextFree = freeList;
+            freeList = slot;
+        }
+
+
+        size_t capacity() const
+        {
+            return Capacity;
+        }
+    };
+}
+
+
+#endif
@@ -0,0 +1,306 @@
+/**
+ * @file PriorityQueue.h
+ * @author Jan Wielgus
+ * @brief Queue that always dequeues the element with the highest priority.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef PRIORITYQUEUE_H
+#define PRIORITYQUEUE_H
+
+#include "IQueue.h"
+#include "GrowingArray.h"
+#include <functional>
+#include <utility>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief D-ary heap stored in the GrowingArray.
+     * enqueue() and dequeue() are O(log n), peek() is O(1),
+     * building from the array of n elements is O(n).
+     * Bigger arity makes the heap shallower (children of a node are
+     * in the same cache line), but every level needs more comparisons.
+     * @tparam T Type of stored elements.
+     * @tparam Compare Functor, compare(a, b) is true if a has lower priority than b
+     * (by default std::less, so the greatest element is dequeued first).
+     * @tparam Arity Amount of children of every heap node (2 is the binary heap).
+     */
+    template <class T, class Compare = std::less<T>, size_t Arity = 2>
+    class PriorityQueue : public IQueue<T>
+    {
+        static_assert(Arity >= 2, "Arity have to be at least 2");
+
+        PlainGrowingArray<T> heap;
+        Compare compare;
+
+        T null_item; // element returned when queue is empty
+        T lastDequeued; // dequeue() returns reference to it
+
+
+    public:
+        explicit PriorityQueue(const Compare& compare = Compare())
+            : compare(compare)
+        {
+        }
+
+
+        /**
+         * @brief Construct a new queue from the array in O(n) time.
+         * @param items Array of elements to copy.
+         * @param amount Amount of elements in the items array.
+         */
+        PriorityQueue(const T* items, size_t amount, const Compare& compare = Compare())
+            : heap(amount), compare(compare)
+        {
+            for (size_t i = 0; i < amount; i++)
+                heap.add(items[i]);
+
+            heapify();
+        }
+
+
+        /**
+         * @brief Add many elements at once. If there are more new elements
+         * than elements already in the queue, the whole heap is rebuilt in O(n),
+         * otherwise they are added one by one.
+         */
+        void enqueueMany(const T* items, size_t amount)
+        {
+            heap.reserve(heap.size() + amount);
+
+            if (amount > heap.size())
+            {
+                for (size_t i = 0; i < amount; i++)
+                    heap.add(items[i]);
+                heapify();
+            }
+            else
+            {
+                for (size_t i = 0; i < amount; i++)
+                    enqueue(items[i]);
+            }
+        }
+
+
+        void clear() override
+        {
+            heap.clear();
+        }
+
+
+        /**
+         * @brief Adds item to the queue.
+         * @return false if allocation failed.
+         */
+        bool enqueue(const T& item) override
+        {
+            if (!heap.add(item))
+                return false;
+
+            siftUp(heap.size() - 1);
+            return true;
+        }
+
+
+        bool enqueue(T&& item)
+        {
+            if (!heap.add(std::move(item)))
+                return false;
+
+            siftUp(heap.size() - 1);
+            return true;
+        }
+
+
+        /**
+         * @brief Removes the element with the highest priority.
+         * @return Reference to the dequeued element (valid until the next dequeue)
+         * or null item if queue is empty.
+         */
+        T& dequeue() override
+        {
+            size_t length = heap.size();
+            if (length == 0)
+                return null_item;
+
+            T* elements = heap.toArray();
+            lastDequeued = std::move(elements[0]);
+
+            if (length > 1)
+                elements[0] = std::move(elements[length - 1]);
+            heap.remove(length - 1);
+
+            if (length > 2)
+                siftDown(0);
+
+            return lastDequeued;
+        }
+
+
+        /**
+         * @return Reference to the element with the highest priority
+         * or null item if queue is empty. Element shouldn't be modified
+         * in a way that changes its priority.
+         */
+        T& peek() override
+        {
+            return heap.isEmpty() ? null_item : heap.toArray()[0];
+        }
+
+
+        const T& peek() const override
+        {
+            return heap.isEmpty() ? null_item : heap.toArray()[0];
+        }
+
+
+        bool isEmpty() const override
+        {
+            return heap.isEmpty();
+        }
+
+
+        /**
+         * @return Always false (queue grows when needed).
+         */
+        bool isFull() const override
+        {
+            return false;
+        }
+
+
+        size_t getQueueLength() const override
+        {
+            return heap.size();
+        }
+
+
+        /**
+         * @brief Allocate space for at least newCapacity elements.
+         */
+        void reserve(size_t newCapacity)
+        {
+            heap.reserve(newCapacity);
+        }
+
+
+        /**
+         * @brief Call function(element) for every element in the heap order (not sorted).
+         * Elements can be only read (changing them could break the heap).
+         */
+        template <class Function>
+        void forEach(Function&& function) const
+        {
+            heap.forEach(function);
+        }
+
+
+        /**
+         * @brief Fold all elements (in the heap order): result = function(result, element), starting with init.
+         */
+        template <class Result, class Function>
+        Result reduce(Result init, Function&& function) const
+        {
+            return heap.reduce(init, function);
+        }
+
+
+        /**
+         * @return Amount of elements for which predicate(element) is true.
+         */
+        template <class Predicate>
+        size_t countIf(Predicate&& predicate) const
+        {
+            return heap.countIf(predicate);
+        }
+
+
+    private:
+        static size_t parentOf(size_t index)
+        {
+            return (index - 1) / Arity;
+        }
+
+
+        static size_t firstChildOf(size_t index)
+        {
+            return index * Arity + 1;
+        }
+
+
+        /**
+         * @brief Move element up until its parent has higher priority.
+         * Element is moved out only once, parents are moved down in its place.
+         */
+        void siftUp(size_t index)
+        {
+            T* elements = heap.toArray();
+            T item = std::move(elements[index]);
+
+            while (index > 0)
+            {
+                size_t parent = parentOf(index);
+                if (!compare(elements[parent], item))
+                    break;
+
+                elements[index] = std::move(elements[parent]);
+                index = parent;
+            }
+
+            elements[index] = std::move(item);
+        }
+
+
+        /**
+         * @brief Move element down until all its children have lower priority.
+         */
+        void siftDown(size_t index)
+        {
+            T* elements = heap.toArray();
+            size_t length = heap.size();
+            T item = std::move(elements[index]);
+
+            while (true)
+            {
+                size_t firstChild = firstChildOf(index);
+                if (firstChild >= length)
+                    break;
+
+                size_t lastChild = firstChild + Arity < length ? firstChild + Arity : length;
+                size_t best = firstChild;
+                for (size_t child = firstChild + 1; child < lastChild; child++)
+                    if (compare(elements[best], elements[child]))
+                        best = child;
+
+                if (!compare(item, elements[best]))
+                    break;
+
+                elements[index] = std::move(elements[best]);
+                index = best;
+            }
+
+            elements[index] = std::move(item);
+        }
+
+
+        /**
+         * @brief Restore the heap property of the whole array
+         * (sift down all nodes that have children, from the last one).
+         */
+        void heapify()
+        {
+            size_t length = heap.size();
+            if (length < 2)
+                return;
+
+            for (size_t i = parentOf(length - 1) + 1; i > 0; i--)
+                siftDown(i - 1);
+        }
+    };
+}
+
+
+#endif
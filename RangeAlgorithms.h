@@ -0,0 +1,123 @@
+/**
+ * @file RangeAlgorithms.h
+ * @author Jan Wielgus
+ * @brief Plain loops over contiguous and ring ranges used by forEach(), reduce(),
+ * transformInPlace() and countIf() methods of data structures.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef RANGEALGORITHMS_H
+#define RANGEALGORITHMS_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#else
+    #include <cstddef>
+#endif
+
+
+namespace SimpleDataStructures
+{
+    namespace RangeAlgorithms
+    {
+        /**
+         * @brief Call function(element) for every element of the array.
+         * Function is a template parameter, so it is inlined into the loop.
+         */
+        template <class T, class Function>
+        void forEach(T* array, size_t length, Function& function)
+        {
+            for (size_t i = 0; i < length; i++)
+                function(array[i]);
+        }
+
+
+        /**
+         * @brief Fold elements from the first to the last: result = function(result, element).
+         * Integer reductions are vectorized by the compiler, floating point ones
+         * only with -ffast-math (order of additions would change).
+         */
+        template <class T, class Result, class Function>
+        Result reduce(const T* array, size_t length, Result result, Function& function)
+        {
+            for (size_t i = 0; i < length; i++)
+                result = function(result, array[i]);
+
+            return result;
+        }
+
+
+        /**
+         * @brief Replace every element with function(element).
+         */
+        template <class T, class Function>
+        void transformInPlace(T* array, size_t length, Function& function)
+        {
+            for (size_t i = 0; i < length; i++)
+                array[i] = function(array[i]);
+        }
+
+
+        /**
+         * @return Amount of elements for which predicate(element) is true.
+         */
+        template <class T, class Predicate>
+        size_t countIf(const T* array, size_t length, Predicate& predicate)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < length; i++)
+                count += predicate(array[i]) ? 1 : 0;
+
+            return count;
+        }
+
+
+
+        /**
+         * @brief Ring buffer versions. Elements are processed in the queue order
+         * as at most two contiguous parts: from the front index to the array end
+         * and from the array beginning.
+         * @param array Ring array.
+         * @param arraySize Size of the ring array.
+         * @param frontIndex Index of the first element.
+         * @param length Amount of elements in the ring.
+         */
+        template <class T, class Function>
+        void forEachInRing(T* array, size_t arraySize, size_t frontIndex, size_t length, Function& function)
+        {
+            size_t firstPart = length < arraySize - frontIndex ? length : arraySize - frontIndex;
+            forEach(array + frontIndex, firstPart, function);
+            forEach(array, length - firstPart, function);
+        }
+
+
+        template <class T, class Result, class Function>
+        Result reduceRing(const T* array, size_t arraySize, size_t frontIndex, size_t length, Result result, Function& function)
+        {
+            size_t firstPart = length < arraySize - frontIndex ? length : arraySize - frontIndex;
+            result = reduce(array + frontIndex, firstPart, result, function);
+            return reduce(array, length - firstPart, result, function);
+        }
+
+
+        template <class T, class Function>
+        void transformRing(T* array, size_t arraySize, size_t frontIndex, size_t length, Function& function)
+        {
+            size_t firstPart = length < arraySize - frontIndex ? length : arraySize - frontIndex;
+            transformInPlace(array + frontIndex, firstPart, function);
+            transformInPlace(array, length - firstPart, function);
+        }
+
+
+        template <class T, class Predicate>
+        size_t countIfInRing(const T* array, size_t arraySize, size_t frontIndex, size_t length, Predicate& predicate)
+        {
+            size_t firstPart = length < arraySize - frontIndex ? length : arraySize - frontIndex;
+            return countIf(array + frontIndex, firstPart, predicate) + countIf(array, length - firstPart, predicate);
+        }
+    }
+}
+
+
+#endif
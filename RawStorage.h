@@ -0,0 +1,65 @@
+/**
+ * @file RawStorage.h
+ * @author Jan Wielgus
+ * @brief Allocation of uninitialized storage for containers that construct
+ * their elements in place (GrowingArray, GrowingQueue...).
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef RAWSTORAGE_H
+#define RAWSTORAGE_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+#include <new>
+
+
+namespace SimpleDataStructures
+{
+    namespace RawStorage
+    {
+        /**
+         * @brief Allocate uninitialized, properly aligned storage for amount elements.
+         * @return Pointer to the storage or nullptr if amount is 0.
+         */
+        template <class T>
+        T* allocate(size_t amount)
+        {
+            if (amount == 0)
+                return nullptr;
+
+        #ifdef __cpp_aligned_new
+            if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                return static_cast<T*>(::operator new(amount * sizeof(T), std::align_val_t(alignof(T))));
+        #endif
+
+            return static_cast<T*>(::operator new(amount * sizeof(T)));
+        }
+
+
+        /**
+         * @brief Release storage allocated by allocate() (elements have to be already destroyed).
+         */
+        template <class T>
+        void deallocate(T* storage)
+        {
+            if (storage == nullptr)
+                return;
+
+        #ifdef __cpp_aligned_new
+            if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(storage, std::align_val_t(alignof(T)));
+                return;
+            }
+        #endif
+
+            ::operator delete(storage);
+        }
+    }
+}
+
+
+#endif
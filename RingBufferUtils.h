@@ -0,0 +1,85 @@
+/**
+ * @file RingBufferUtils.h
+ * @author Jan Wielgus
+ * @brief Helper functions shared by ring buffer based queues.
+ * @date 2026-10-17
+ * 
+ */
+
+#ifndef RINGBUFFERUTILS_H
+#define RINGBUFFERUTILS_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+#include <type_traits>
+#include <string.h>
+
+
+namespace SimpleDataStructures
+{
+    namespace RingBufferUtils
+    {
+        /**
+         * @brief Copy amount elements from source to destination (ranges can't overlap).
+         * Uses memcpy for trivially copyable types and assignment otherwise.
+         */
+        template <class T>
+        void copyElements(T* destination, const T* source, size_t amount)
+        {
+            if (amount == 0)
+                return;
+
+            if (std::is_trivially_copyable<T>::value)
+                memcpy((void*)destination, (const void*)source, amount * sizeof(T));
+            else
+                for (size_t i = 0; i < amount; i++)
+                    destination[i] = source[i];
+        }
+
+
+        /**
+         * @brief Copy amount elements to the ring array starting at startIndex
+         * (at most two contiguous copies: to the end of the array and from its beginning).
+         * @param array Ring array.
+         * @param arraySize Size of the ring array.
+         * @param startIndex Index of the first element to write (less than arraySize).
+         * @param source Elements to copy.
+         * @param amount Amount of elements to copy (not greater than arraySize).
+         */
+        template <class T>
+        void copyToRing(T* array, size_t arraySize, size_t startIndex, const T* source, size_t amount)
+        {
+            size_t firstSegment = arraySize - startIndex;
+            if (firstSegment > amount)
+                firstSegment = amount;
+
+            copyElements(array + startIndex, source, firstSegment);
+            copyElements(array, source + firstSegment, amount - firstSegment);
+        }
+
+
+        /**
+         * @brief Copy amount elements from the ring array starting at startIndex
+         * (at most two contiguous copies: to the end of the array and from its beginning).
+         * @param destination Where to copy elements.
+         * @param array Ring array.
+         * @param arraySize Size of the ring array.
+         * @param startIndex Index of the first element to read (less than arraySize).
+         * @param amount Amount of elements to copy (not greater than arraySize).
+         */
+        template <class T>
+        void copyFromRing(T* destination, const T* array, size_t arraySize, size_t startIndex, size_t amount)
+        {
+            size_t firstSegment = arraySize - startIndex;
+            if (firstSegment > amount)
+                firstSegment = amount;
+
+            copyElements(destination, array + startIndex, firstSegment);
+            copyElements(destination + firstSegment, array, amount - firstSegment);
+        }
+    }
+}
+
+
+#endif
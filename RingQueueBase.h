@@ -0,0 +1,405 @@
+/**
+ * @file RingQueueBase.h
+ * @author Jan Wielgus
+ * @brief Ring buffer queue implementation shared by queues with runtime
+ * and compile-time capacity.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef RINGQUEUEBASE_H
+#define RINGQUEUEBASE_H
+
+#include "StaticInterfaces.h"
+#include "Span.h"
+#include "StlIterators.h"
+#include "RingBufferUtils.h"
+#include "RangeAlgorithms.h"
+#include <utility>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Queue operations on a ring buffer, without virtual methods (CRTP).
+     * Derived class owns the array and provides (can be protected, with this class as a friend):
+     * - T* getArray() and const T* getArray() const,
+     * - size_t getCapacity() const (can be static constexpr),
+     * - size_t wrapIndex(size_t index) const (can be static constexpr),
+     *   wraps index lower than 2 * capacity.
+     * @tparam Derived Queue class that derives from this one.
+     * @tparam T Type of stored elements.
+     */
+    template <class Derived, class T>
+    class RingQueueBase : public QueueInterface<Derived, T>
+    {
+    protected:
+        size_t queueFrontIndex = 0; // element to be dequeued in the first place
+        size_t queueLength = 0; // amount of elements in the queue
+
+        T null_item; // element returned when queue is empty and dequeue() is called
+
+
+        constexpr RingQueueBase()
+            : null_item{}
+        {
+        }
+
+
+        constexpr RingQueueBase(const RingQueueBase& other) = default;
+        RingQueueBase& operator=(const RingQueueBase& other) = default;
+
+
+    public:
+        using QueueInterface<Derived, T>::derived;
+
+
+        void clear()
+        {
+            queueFrontIndex = 0;
+            queueLength = 0;
+        }
+
+
+        bool enqueue(const T& item)
+        {
+            if (isFull())
+                return false;
+
+            array()[derived().wrapIndex(queueFrontIndex + queueLength)] = item;
+            queueLength++;
+            return true;
+        }
+
+
+        T& dequeue()
+        {
+            if (isEmpty())
+                return null_item;
+
+            T& itemToReturn = array()[queueFrontIndex];
+
+            queueLength--;
+            queueFrontIndex = derived().wrapIndex(queueFrontIndex + 1); // move to the next item
+
+            return itemToReturn;
+        }
+
+
+        T& peek()
+        {
+            return isEmpty() ? null_item : array()[queueFrontIndex];
+        }
+
+
+        const T& peek() const
+        {
+            return isEmpty() ? null_item : array()[queueFrontIndex];
+        }
+
+
+        /**
+         * @brief Removes item at the index. Elements before it are moved one place back,
+         * so this is fastest for elements close to the queue beginning.
+         * @param index Index of an item to dequeue (0 is the first element).
+         * @return Reference to the dequeued item (valid until the next modification)
+         * or null item if index is out of bounds.
+         */
+        T& dequeue(size_t index)
+        {
+            if (index >= queueLength)
+                return null_item;
+
+            // move the item to the queue front and dequeue it from there
+            T* items = array();
+            size_t current = derived().wrapIndex(queueFrontIndex + index);
+            T item = std::move(items[current]);
+            for (size_t i = index; i > 0; i--)
+            {
+                size_t previous = current == 0 ? capacity() - 1 : current - 1;
+                items[current] = std::move(items[previous]);
+                current = previous;
+            }
+            items[queueFrontIndex] = std::move(item);
+
+            return RingQueueBase::dequeue();
+        }
+
+
+        T& peek(size_t index)
+        {
+            return index < queueLength ? array()[derived().wrapIndex(queueFrontIndex + index)] : null_item;
+        }
+
+
+        const T& peek(size_t index) const
+        {
+            return index < queueLength ? array()[derived().wrapIndex(queueFrontIndex + index)] : null_item;
+        }
+
+
+        /**
+         * @brief Returns all elements of the queue (in order) as at most two contiguous parts
+         * of the internal array, so they can be processed without copying.
+         * Valid until the next modification of the queue.
+         */
+        TwoPartSpan<T> getSpans()
+        {
+            size_t contiguous = capacity() - queueFrontIndex;
+            if (queueLength <= contiguous)
+                return TwoPartSpan<T>(Span<T>(array() + queueFrontIndex, queueLength), Span<T>());
+
+            return TwoPartSpan<T>(Span<T>(array() + queueFrontIndex, contiguous), Span<T>(array(), queueLength - contiguous));
+        }
+
+
+        TwoPartSpan<const T> getSpans() const
+        {
+            size_t contiguous = capacity() - queueFrontIndex;
+            if (queueLength <= contiguous)
+                return TwoPartSpan<const T>(Span<const T>(array() + queueFrontIndex, queueLength), Span<const T>());
+
+            return TwoPartSpan<const T>(Span<const T>(array() + queueFrontIndex, contiguous), Span<const T>(array(), queueLength - contiguous));
+        }
+
+
+        /**
+         * @brief Iterators for the range-based for loop and STL algorithms
+         * (from the first to the last element, random access).
+         */
+        RingIterator<T> begin()
+        {
+            return RingIterator<T>(array(), capacity(), queueFrontIndex, 0);
+        }
+
+
+        RingIterator<T> end()
+        {
+            return RingIterator<T>(array(), capacity(), queueFrontIndex, queueLength);
+        }
+
+
+        RingIterator<const T> begin() const
+        {
+            return RingIterator<const T>(array(), capacity(), queueFrontIndex, 0);
+        }
+
+
+        RingIterator<const T> end() const
+        {
+            return RingIterator<const T>(array(), capacity(), queueFrontIndex, queueLength);
+        }
+
+
+        /**
+         * @brief Call function(element) for every element (from the front).
+         * The ring is processed as two contiguous parts, so simple functions are vectorized.
+         */
+        template <class Function>
+        void forEach(Function&& function)
+        {
+            RangeAlgorithms::forEachInRing(array(), capacity(), queueFrontIndex, queueLength, function);
+        }
+
+
+        template <class Function>
+        void forEach(Function&& function) const
+        {
+            RangeAlgorithms::forEachInRing(array(), capacity(), queueFrontIndex, queueLength, function);
+        }
+
+
+        /**
+         * @brief Fold all elements from the front: result = function(result, element), starting with init.
+         * @return Final result.
+         */
+        template <class Result, class Function>
+        Result reduce(Result init, Function&& function) const
+        {
+            return RangeAlgorithms::reduceRing(array(), capacity(), queueFrontIndex, queueLength, init, function);
+        }
+
+
+        /**
+         * @brief Replace every element with function(element).
+         */
+        template <class Function>
+        void transformInPlace(Function&& function)
+        {
+            RangeAlgorithms::transformRing(array(), capacity(), queueFrontIndex, queueLength, function);
+        }
+
+
+        /**
+         * @return Amount of elements for which predicate(element) is true.
+         */
+        template <class Predicate>
+        size_t countIf(Predicate&& predicate) const
+        {
+            return RangeAlgorithms::countIfInRing(array(), capacity(), queueFrontIndex, queueLength, predicate);
+        }
+
+
+        constexpr bool isEmpty() const
+        {
+            return queueLength == 0;
+        }
+
+
+        constexpr bool isFull() const
+        {
+            return queueLength == capacity();
+        }
+
+
+        constexpr size_t getQueueLength() const
+        {
+            return queueLength;
+        }
+
+
+        /**
+         * @brief Adds up to amount items to the end of the queue
+         * (with at most two contiguous copies).
+         * @param items Pointer to the first item to add.
+         * @param amount Amount of items to add.
+         * @return Amount of added items (less than amount if queue became full).
+         */
+        size_t enqueueBulk(const T* items, size_t amount)
+        {
+            if (amount > capacity() - queueLength)
+                amount = capacity() - queueLength;
+
+            if (amount == 0)
+                return 0;
+
+            RingBufferUtils::copyToRing(array(), capacity(), derived().wrapIndex(queueFrontIndex + queueLength), items, amount);
+            queueLength += amount;
+            return amount;
+        }
+
+
+        /**
+         * @brief Removes up to amount items from the queue beginning and copies them to output
+         * (with at most two contiguous copies).
+         * @param output Pointer to the array for at least amount items.
+         * @param amount Amount of items to remove.
+         * @return Amount of removed items (less than amount if queue became empty).
+         */
+        size_t dequeueBulk(T* output, size_t amount)
+        {
+            if (amount > queueLength)
+                amount = queueLength;
+
+            if (amount == 0)
+                return 0;
+
+            RingBufferUtils::copyFromRing(output, array(), capacity(), queueFrontIndex, amount);
+            queueFrontIndex = derived().wrapIndex(queueFrontIndex + amount);
+            queueLength -= amount;
+            return amount;
+        }
+
+
+        /**
+         * @brief Returns elements from the queue beginning that are contiguous in memory
+         * (to the end of the internal array). If span is shorter than the queue length,
+         * rest of elements will be available after discard() of these.
+         * @return Span of elements that can be read without copying.
+         */
+        Span<T> peekContiguous()
+        {
+            size_t contiguous = capacity() - queueFrontIndex;
+            return Span<T>(array() + queueFrontIndex, queueLength < contiguous ? queueLength : contiguous);
+        }
+
+
+        Span<const T> peekContiguous() const
+        {
+            size_t contiguous = capacity() - queueFrontIndex;
+            return Span<const T>(array() + queueFrontIndex, queueLength < contiguous ? queueLength : contiguous);
+        }
+
+
+        /**
+         * @brief Removes up to amount items from the queue beginning without copying them
+         * (for example after processing the peekContiguous() span).
+         * @return Amount of removed items.
+         */
+        size_t discard(size_t amount)
+        {
+            if (amount > queueLength)
+                amount = queueLength;
+
+            if (amount == 0)
+                return 0;
+
+            queueFrontIndex = derived().wrapIndex(queueFrontIndex + amount);
+            queueLength -= amount;
+            return amount;
+        }
+
+
+        /**
+         * @brief Returns free space after the queue end that is contiguous in memory.
+         * Write new items there and call commit() to add them to the queue.
+         * @return Span of slots that can be written directly (empty if queue is full).
+         */
+        Span<T> reserveContiguous()
+        {
+            if (isFull())
+                return Span<T>();
+
+            return Span<T>(array() + derived().wrapIndex(queueFrontIndex + queueLength), contiguousFreeSlots());
+        }
+
+
+        /**
+         * @brief Adds amount items that were written to the reserveContiguous() span.
+         * @param amount Amount of written items (not greater than the reserved span size).
+         * @return Amount of added items (at most the reserveContiguous() span size).
+         */
+        size_t commit(size_t amount)
+        {
+            size_t reserved = contiguousFreeSlots();
+            if (amount > reserved)
+                amount = reserved;
+
+            queueLength += amount;
+            return amount;
+        }
+
+
+    private:
+        /**
+         * @return Amount of free slots from the queue end to the end of the array.
+         */
+        size_t contiguousFreeSlots() const
+        {
+            size_t contiguous = capacity() - derived().wrapIndex(queueFrontIndex + queueLength);
+            size_t freeSlots = capacity() - queueLength;
+            return freeSlots < contiguous ? freeSlots : contiguous;
+        }
+
+
+        T* array()
+        {
+            return derived().getArray();
+        }
+
+
+        const T* array() const
+        {
+            return derived().getArray();
+        }
+
+
+        constexpr size_t capacity() const
+        {
+            return derived().getCapacity();
+        }
+    };
+}
+
+
+#endif
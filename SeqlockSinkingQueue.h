@@ -0,0 +1,252 @@
+/**
+ * @file SeqlockSinkingQueue.h
+ * @author Jan Wielgus
+ * @brief Sinking queue written by one thread, from which other threads
+ * can take consistent copies of the whole content without locking.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef SEQLOCKSINKINGQUEUE_H
+#define SEQLOCKSINKINGQUEUE_H
+
+#include "CacheLine.h"
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <stdint.h>
+#include <string.h>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Single-writer/multi-reader sinking queue (keeps the last QueueSize elements).
+     * Writer increments the sequence counter before and after every modification
+     * (it is odd while the content is changed). Reader copies the content and
+     * checks that the counter was even and didn't change in the meantime,
+     * otherwise the copy could be torn and is retried.
+     * Writer never waits for readers, readers never block the writer.
+     * Elements are stored as machine words accessed by lock-free atomics,
+     * so also bigger structures don't need any lock inside the library.
+     * enqueue() and clear() can be called only from one (writer) thread,
+     * trySnapshot(), snapshot() and getQueueLength() from any thread.
+     * @tparam T Trivially copyable type of elements (of any size).
+     */
+    template <class T>
+    class SeqlockSinkingQueue
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "SeqlockSinkingQueue works only with trivially copyable types");
+
+        typedef uintptr_t Word;
+        static constexpr size_t WordsPerElement = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+#ifdef __cpp_lib_atomic_is_always_lock_free
+        static_assert(std::atomic<Word>::is_always_lock_free, "SeqlockSinkingQueue needs lock-free atomic words");
+#endif
+
+        const size_t QueueSize;
+
+        // elements are read while they could be written, so they are accessed only by relaxed atomics
+        // (WordsPerElement words for every element)
+        std::atomic<Word>* array = nullptr;
+        std::atomic<size_t> queueFrontIndex{0};
+        std::atomic<size_t> queueLength{0};
+
+        alignas(CacheLineSize) std::atomic<size_t> sequence{0}; // odd while writer modifies the queue
+
+
+    public:
+        explicit SeqlockSinkingQueue(size_t queueSize)
+            : QueueSize(queueSize)
+        {
+            if (QueueSize > 0)
+            {
+                // before C++20 atomics are not initialized by the default constructor
+                array = new std::atomic<Word>[QueueSize * WordsPerElement];
+                for (size_t i = 0; i < QueueSize * WordsPerElement; i++)
+                    array[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+
+        SeqlockSinkingQueue(const SeqlockSinkingQueue&) = delete;
+        SeqlockSinkingQueue& operator=(const SeqlockSinkingQueue&) = delete;
+
+
+        ~SeqlockSinkingQueue()
+        {
+            delete[] array;
+        }
+
+
+        /**
+         * @brief Adds item to the end of the queue. If queue is full, the oldest item is removed.
+         * Can be called only by the writer.
+         * @return false if queue size is 0.
+         */
+        bool enqueue(const T& item)
+        {
+            if (QueueSize == 0)
+                return false;
+
+            size_t front = queueFrontIndex.load(std::memory_order_relaxed);
+            size_t length = queueLength.load(std::memory_order_relaxed);
+            size_t queueEndIndex = front + length;
+            if (queueEndIndex >= QueueSize)
+                queueEndIndex -= QueueSize;
+
+            beginWrite();
+
+            storeElement(queueEndIndex, item);
+            if (length == QueueSize)
+                queueFrontIndex.store(front + 1 == QueueSize ? 0 : front + 1, std::memory_order_relaxed);
+            else
+                queueLength.store(length + 1, std::memory_order_relaxed);
+
+            endWrite();
+            return true;
+        }
+
+
+        /**
+         * @brief Removes all elements. Can be called only by the writer.
+         */
+        void clear()
+        {
+            beginWrite();
+            queueFrontIndex.store(0, std::memory_order_relaxed);
+            queueLength.store(0, std::memory_order_relaxed);
+            endWrite();
+        }
+
+
+        /**
+         * @brief Single attempt to copy the newest elements (from the oldest to the newest).
+         * @param output [out] Array of at least maxAmount elements.
+         * Content is unspecified if this method return false.
+         * @param maxAmount Max amount of elements to copy.
+         * If queue is longer, only the newest maxAmount elements are copied.
+         * @param copiedAmount [out] Amount of copied elements (set if succeeded).
+         * @return false if writer modified the queue during copying (try again).
+         */
+        bool trySnapshot(T* output, size_t maxAmount, size_t& copiedAmount) const
+        {
+            size_t sequenceBefore = sequence.load(std::memory_order_acquire);
+            if (sequenceBefore & 1)
+                return false;
+
+            size_t front = queueFrontIndex.load(std::memory_order_relaxed);
+            size_t length = queueLength.load(std::memory_order_relaxed);
+            size_t amount = length < maxAmount ? length : maxAmount;
+
+            size_t index = front + (length - amount);
+            if (index >= QueueSize)
+                index -= QueueSize;
+
+            for (size_t i = 0; i < amount; i++)
+            {
+                loadElement(index, output[i]);
+                index = index + 1 == QueueSize ? 0 : index + 1;
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) != sequenceBefore)
+                return false;
+
+            copiedAmount = amount;
+            return true;
+        }
+
+
+        /**
+         * @brief Copy the newest elements (from the oldest to the newest).
+         * Retries until the copy is consistent (yields between attempts).
+         * @param output [out] Array of at least maxAmount elements.
+         * @param maxAmount Max amount of elements to copy.
+         * @return Amount of copied elements.
+         */
+        size_t snapshot(T* output, size_t maxAmount) const
+        {
+            size_t copiedAmount;
+            while (!trySnapshot(output, maxAmount, copiedAmount))
+                std::this_thread::yield();
+
+            return copiedAmount;
+        }
+
+
+        /**
+         * @return Amount of elements in the queue (may be outdated when writer is working).
+         */
+        size_t getQueueLength() const
+        {
+            return queueLength.load(std::memory_order_relaxed);
+        }
+
+
+        /**
+         * @return Max amount of elements in the queue.
+         */
+        size_t getCapacity() const
+        {
+            return QueueSize;
+        }
+
+
+        /**
+         * @return Amount of modifications of the queue (changes after every enqueue() and clear()).
+         * Can be used by readers to check if there is anything new.
+         */
+        size_t getVersion() const
+        {
+            return sequence.load(std::memory_order_acquire) / 2;
+        }
+
+
+    private:
+        void storeElement(size_t index, const T& item)
+        {
+            Word words[WordsPerElement] = {};
+            memcpy((void*)words, (const void*)&item, sizeof(T));
+
+            std::atomic<Word>* element = array + index * WordsPerElement;
+            for (size_t i = 0; i < WordsPerElement; i++)
+                element[i].store(words[i], std::memory_order_relaxed);
+        }
+
+
+        /**
+         * @brief Copy element at the index to the output (can be torn if writer is working,
+         * such copy is rejected by the sequence check).
+         */
+        void loadElement(size_t index, T& output) const
+        {
+            Word words[WordsPerElement];
+            const std::atomic<Word>* element = array + index * WordsPerElement;
+            for (size_t i = 0; i < WordsPerElement; i++)
+                words[i] = element[i].load(std::memory_order_relaxed);
+
+            memcpy((void*)&output, (const void*)words, sizeof(T));
+        }
+
+
+        void beginWrite()
+        {
+            // only the writer changes the sequence, so there is no need for atomic increment
+            size_t current = sequence.load(std::memory_order_relaxed);
+            sequence.store(current + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release); // odd sequence is visible before the data
+        }
+
+
+        void endWrite()
+        {
+            size_t current = sequence.load(std::memory_order_relaxed);
+            sequence.store(current + 1, std::memory_order_release);
+        }
+    };
+}
+
+
+#endif
@@ -0,0 +1,214 @@
+/**
+ * @file SimdKernels.h
+ * @author Jan Wielgus
+ * @brief Loops over contiguous arrays vectorized with SSE/AVX when the compiler
+ * enables them (SSE2 is always enabled on x86-64, AVX needs -mavx, -mavx2 or -march=native).
+ * Other platforms use scalar versions.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef SIMDKERNELS_H
+#define SIMDKERNELS_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#else
+    #include <cstddef>
+#endif
+#include <type_traits>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVX__) || defined(__SSE__) || defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
+
+namespace SimpleDataStructures
+{
+    namespace SimdKernels
+    {
+        /**
+         * @brief Scalar sum of a[i] * b[i].
+         */
+        template <class T>
+        T dotProductScalar(const T* a, const T* b, size_t length)
+        {
+            T result = 0;
+            for (size_t i = 0; i < length; i++)
+                result += a[i] * b[i];
+
+            return result;
+        }
+
+
+        /**
+         * @brief Sum of a[i] * b[i] for i in [0, length).
+         * Arrays don't have to be aligned.
+         */
+        template <class T>
+        T dotProduct(const T* a, const T* b, size_t length)
+        {
+            return dotProductScalar(a, b, length);
+        }
+
+
+        template <>
+        inline float dotProduct<float>(const float* a, const float* b, size_t length)
+        {
+            size_t i = 0;
+            float result = 0;
+
+#if defined(__AVX__)
+            // two accumulators hide the latency of the add/fma
+            __m256 sum0 = _mm256_setzero_ps();
+            __m256 sum1 = _mm256_setzero_ps();
+            for (; i + 16 <= length; i += 16)
+            {
+    #if defined(__FMA__)
+                sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum0);
+                sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), sum1);
+    #else
+                sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+                sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8)));
+    #endif
+            }
+            sum0 = _mm256_add_ps(sum0, sum1);
+            __m128 sum = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+#elif defined(__SSE__)
+            __m128 sum = _mm_setzero_ps();
+            __m128 sum1 = _mm_setzero_ps();
+            for (; i + 8 <= length; i += 8)
+            {
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+                sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+            }
+            sum = _mm_add_ps(sum, sum1);
+#endif
+
+#if defined(__AVX__) || defined(__SSE__)
+            // horizontal sum of 4 floats
+            __m128 shuffled = _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1));
+            sum = _mm_add_ps(sum, shuffled);
+            shuffled = _mm_movehl_ps(shuffled, sum);
+            sum = _mm_add_ss(sum, shuffled);
+            result = _mm_cvtss_f32(sum);
+#endif
+
+            return result + dotProductScalar(a + i, b + i, length - i);
+        }
+
+
+        /**
+         * @brief Scalar linear search.
+         * @return Index of the first element equal to the value or length if not found.
+         */
+        template <class T>
+        size_t findScalar(const T* array, size_t length, const T& value)
+        {
+            for (size_t i = 0; i < length; i++)
+                if (array[i] == value)
+                    return i;
+
+            return length;
+        }
+
+
+        namespace Detail
+        {
+            /**
+             * @brief Type used by vectorized find for T: unsigned integer of the same size
+             * for integral types (equality is bitwise), float, double, or void if
+             * T can't be compared with SIMD (then scalar loop is used).
+             */
+            template <class T>
+            struct FindType
+            {
+                typedef typename std::conditional<std::is_same<T, float>::value || std::is_same<T, double>::value, T,
+                    typename std::conditional<!std::is_integral<T>::value, void,
+                    typename std::conditional<sizeof(T) == 1, uint8_t,
+                    typename std::conditional<sizeof(T) == 2, uint16_t,
+                    typename std::conditional<sizeof(T) == 4, uint32_t,
+                    typename std::conditional<sizeof(T) == 8, uint64_t, void>::type>::type>::type>::type>::type>::type type;
+            };
+
+
+        #if defined(__AVX2__)
+            inline __m256i loadVector(const void* p) { return _mm256_loadu_si256((const __m256i*)p); }
+            inline bool isAnySet(__m256i mask) { return !_mm256_testz_si256(mask, mask); }
+
+            inline __m256i equal(const uint8_t* p, uint8_t v) { return _mm256_cmpeq_epi8(loadVector(p), _mm256_set1_epi8((char)v)); }
+            inline __m256i equal(const uint16_t* p, uint16_t v) { return _mm256_cmpeq_epi16(loadVector(p), _mm256_set1_epi16((short)v)); }
+            inline __m256i equal(const uint32_t* p, uint32_t v) { return _mm256_cmpeq_epi32(loadVector(p), _mm256_set1_epi32((int)v)); }
+            inline __m256i equal(const uint64_t* p, uint64_t v) { return _mm256_cmpeq_epi64(loadVector(p), _mm256_set1_epi64x((long long)v)); }
+            inline __m256i equal(const float* p, float v) { return _mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(p), _mm256_set1_ps(v), _CMP_EQ_OQ)); }
+            inline __m256i equal(const double* p, double v) { return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(p), _mm256_set1_pd(v), _CMP_EQ_OQ)); }
+            inline __m256i either(__m256i a, __m256i b) { return _mm256_or_si256(a, b); }
+
+            const size_t VectorBytes = 32;
+        #elif defined(__SSE2__)
+            inline __m128i loadVector(const void* p) { return _mm_loadu_si128((const __m128i*)p); }
+            inline bool isAnySet(__m128i mask) { return _mm_movemask_epi8(mask) != 0; }
+
+            inline __m128i equal(const uint8_t* p, uint8_t v) { return _mm_cmpeq_epi8(loadVector(p), _mm_set1_epi8((char)v)); }
+            inline __m128i equal(const uint16_t* p, uint16_t v) { return _mm_cmpeq_epi16(loadVector(p), _mm_set1_epi16((short)v)); }
+            inline __m128i equal(const uint32_t* p, uint32_t v) { return _mm_cmpeq_epi32(loadVector(p), _mm_set1_epi32((int)v)); }
+            inline __m128i equal(const uint64_t* p, uint64_t v)
+            {
+                // SSE2 has no 64 bit compare: both 32 bit halves have to be equal
+                __m128i halves = _mm_cmpeq_epi32(loadVector(p), _mm_set1_epi64x((long long)v));
+                return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+            inline __m128i equal(const float* p, float v) { return _mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(p), _mm_set1_ps(v))); }
+            inline __m128i equal(const double* p, double v) { return _mm_castpd_si128(_mm_cmpeq_pd(_mm_loadu_pd(p), _mm_set1_pd(v))); }
+            inline __m128i either(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+
+            const size_t VectorBytes = 16;
+        #endif
+
+
+            template <class T, class U>
+            size_t find(const T* array, size_t length, const T& value, U*)
+            {
+                size_t i = 0;
+
+            #if defined(__AVX2__) || defined(__SSE2__)
+                // two vectors per step, the exact position is found by the scalar loop
+                const size_t PerVector = VectorBytes / sizeof(U);
+                const U* elements = (const U*)array;
+                U needle;
+                memcpy(&needle, &value, sizeof(U));
+
+                for (; i + 2 * PerVector <= length; i += 2 * PerVector)
+                    if (isAnySet(either(equal(elements + i, needle), equal(elements + i + PerVector, needle))))
+                        break;
+            #endif
+
+                return i + findScalar(array + i, length - i, value);
+            }
+
+
+            template <class T>
+            size_t find(const T* array, size_t length, const T& value, void*)
+            {
+                return findScalar(array, length, value);
+            }
+        }
+
+
+        /**
+         * @brief Linear search that compares 16-32 elements at once with SSE2/AVX2
+         * for arithmetic types (other types and platforms use scalar loop).
+         * @return Index of the first element equal to the value or length if not found.
+         */
+        template <class T>
+        size_t find(const T* array, size_t length, const T& value)
+        {
+            return Detail::find(array, length, value, (typename Detail::FindType<T>::type*)nullptr);
+        }
+    }
+}
+
+
+#endif
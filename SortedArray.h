@@ -0,0 +1,249 @@
+/**
+ * @file SortedArray.h
+ * @author Jan Wielgus
+ * @brief Array which elements are always sorted, with binary search lookup.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef SORTEDARRAY_H
+#define SORTEDARRAY_H
+
+#include "GrowingArray.h"
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+
+namespace SimpleDataStructures
+{
+    namespace SortedArrayUtils
+    {
+        /**
+         * @return Index of the first element that is not less than key (size if there is no such element).
+         * @param less Functor, less(element, key) is true if element is before the key.
+         */
+        template <class T, class Key, class Less>
+        size_t lowerBound(const T* array, size_t size, const Key& key, Less less)
+        {
+            size_t first = 0;
+            while (size > 0)
+            {
+                size_t half = size / 2;
+                if (less(array[first + half], key))
+                {
+                    first += half + 1;
+                    size -= half + 1;
+                }
+                else
+                    size = half;
+            }
+
+            return first;
+        }
+
+
+        /**
+         * @return Index of the first element that is greater than key (size if there is no such element).
+         * @param less Functor, less(key, element) is true if key is before the element.
+         */
+        template <class T, class Key, class Less>
+        size_t upperBound(const T* array, size_t size, const Key& key, Less less)
+        {
+            size_t first = 0;
+            while (size > 0)
+            {
+                size_t half = size / 2;
+                if (!less(key, array[first + half]))
+                {
+                    first += half + 1;
+                    size -= half + 1;
+                }
+                else
+                    size = half;
+            }
+
+            return first;
+        }
+
+
+        /**
+         * @brief Sort amount new elements that are after the sorted ones (in place)
+         * and merge both parts. New elements land after the equal old ones.
+         * @param array Sorted array with new elements after the first oldSize ones.
+         * @param oldSize Amount of sorted elements at the array beginning.
+         * @param amount Amount of new elements.
+         * @param less Compare functor for elements.
+         */
+        template <class T, class Less>
+        void sortAndMerge(T* array, size_t oldSize, size_t amount, Less less)
+        {
+            std::stable_sort(array + oldSize, array + oldSize + amount, less);
+            std::inplace_merge(array, array + oldSize, array + oldSize + amount, less);
+        }
+    }
+
+
+
+    /**
+     * @brief Elements are kept sorted in the contiguous GrowingArray,
+     * so lookup is O(log n) and iteration is cache friendly.
+     * Adding or removing a single element is O(n) (elements are shifted),
+     * use insertMany() to add many elements at once in O(n + m log m).
+     * @tparam T Type of stored elements.
+     * @tparam Compare Functor, compare(a, b) is true if a should be before b.
+     */
+    template <class T, class Compare = std::less<T>>
+    class SortedArray
+    {
+        PlainGrowingArray<T> array;
+        Compare compare;
+
+
+    public:
+        explicit SortedArray(const Compare& compare = Compare())
+            : compare(compare)
+        {
+        }
+
+
+        /**
+         * @brief Adds item after all elements that are not greater.
+         * @return false if allocation failed.
+         */
+        bool add(const T& item)
+        {
+            return array.add(item, upperBound(item));
+        }
+
+
+        bool add(T&& item)
+        {
+            size_t index = upperBound(item);
+            return array.add(std::move(item), index);
+        }
+
+
+        /**
+         * @brief Adds many elements at once. New elements are copied to the array end,
+         * sorted there and merged with the existing ones.
+         * @param items Array of elements to add.
+         * @param amount Amount of elements in the items array.
+         */
+        void insertMany(const T* items, size_t amount)
+        {
+            if (amount == 0)
+                return;
+
+            size_t oldSize = array.size();
+            array.reserve(oldSize + amount);
+            for (size_t i = 0; i < amount; i++)
+                array.add(items[i]);
+
+            SortedArrayUtils::sortAndMerge(array.toArray(), oldSize, amount, compare);
+        }
+
+
+        bool remove(size_t index)
+        {
+            return array.remove(index);
+        }
+
+
+        /**
+         * @brief Removes the first element equal to the item.
+         * @return false if there was no such element.
+         */
+        bool removeItem(const T& item)
+        {
+            size_t index = find(item);
+            return index == npos ? false : array.remove(index);
+        }
+
+
+        /**
+         * @return Index of the first element that is not less than the item.
+         */
+        size_t lowerBound(const T& item) const
+        {
+            return SortedArrayUtils::lowerBound(array.toArray(), array.size(), item, compare);
+        }
+
+
+        /**
+         * @return Index of the first element that is greater than the item.
+         */
+        size_t upperBound(const T& item) const
+        {
+            return SortedArrayUtils::upperBound(array.toArray(), array.size(), item, compare);
+        }
+
+
+        /**
+         * @return Index of the first element equal to the item
+         * (neither is less than the other) or npos if not found.
+         */
+        size_t find(const T& item) const
+        {
+            size_t index = lowerBound(item);
+            if (index < array.size() && !compare(item, array.toArray()[index]))
+                return index;
+
+            return npos;
+        }
+
+
+        bool contains(const T& item) const
+        {
+            return find(item) != npos;
+        }
+
+
+        /**
+         * @brief Elements can be only read (changing them could break the order).
+         */
+        const T& get(size_t index) const
+        {
+            return array.get(index);
+        }
+
+
+        const T& operator[](size_t index) const
+        {
+            return array[index];
+        }
+
+
+        const T* toArray() const
+        {
+            return array.toArray();
+        }
+
+
+        size_t size() const
+        {
+            return array.size();
+        }
+
+
+        bool isEmpty() const
+        {
+            return array.isEmpty();
+        }
+
+
+        void clear()
+        {
+            array.clear();
+        }
+
+
+        void reserve(size_t newCapacity)
+        {
+            array.reserve(newCapacity);
+        }
+    };
+}
+
+
+#endif
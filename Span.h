@@ -0,0 +1,109 @@
+/**
+ * @file Span.h
+ * @author Jan Wielgus
+ * @brief Non-owning view of contiguous elements (pointer and size).
+ * @date 2026-10-17
+ * 
+ */
+
+#ifndef SPAN_H
+#define SPAN_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Pointer to the first element and amount of elements.
+     * Doesn't own the memory. Can be used in range-based for loop.
+     * @tparam T Type of elements (can be const).
+     */
+    template <class T>
+    class Span
+    {
+        T* first = nullptr;
+        size_t length = 0;
+
+    public:
+        constexpr Span() {}
+
+        constexpr Span(T* first, size_t length)
+            : first(first), length(length)
+        {
+        }
+
+        constexpr T* data() const
+        {
+            return first;
+        }
+
+        constexpr size_t size() const
+        {
+            return length;
+        }
+
+        constexpr bool isEmpty() const
+        {
+            return length == 0;
+        }
+
+        constexpr T& operator[](size_t index) const
+        {
+            return first[index];
+        }
+
+        constexpr T* begin() const
+        {
+            return first;
+        }
+
+        constexpr T* end() const
+        {
+            return first + length;
+        }
+    };
+
+
+
+    /**
+     * @brief Sequence of elements stored in two contiguous parts
+     * (for example the ring buffer content: from the front to the array end
+     * and from the array beginning). Elements of the second part follow the first part.
+     * @tparam T Type of elements (can be const).
+     */
+    template <class T>
+    class TwoPartSpan
+    {
+    public:
+        Span<T> first;
+        Span<T> second;
+
+        constexpr TwoPartSpan() {}
+
+        constexpr TwoPartSpan(Span<T> first, Span<T> second)
+            : first(first), second(second)
+        {
+        }
+
+        constexpr size_t size() const
+        {
+            return first.size() + second.size();
+        }
+
+        constexpr bool isEmpty() const
+        {
+            return size() == 0;
+        }
+
+        constexpr T& operator[](size_t index) const
+        {
+            return index < first.size() ? first[index] : second[index - first.size()];
+        }
+    };
+}
+
+
+#endif
@@ -0,0 +1,206 @@
+/**
+ * @file SpscQueue.h
+ * @author Jan Wielgus
+ * @brief Lock-free queue for one producer thread (or interrupt)
+ * and one consumer thread.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include "IQueue.h"
+#include "CacheLine.h"
+#include <atomic>
+#include <utility>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Wait-free single-producer/single-consumer ring buffer.
+     * enqueue() can be called only from one (producer) thread, and
+     * dequeue(), tryDequeue(), peek() and clear() only from one (consumer) thread.
+     * isEmpty(), isFull() and getQueueLength() can be called from any thread,
+     * but the result may be outdated.
+     * Producer and consumer indexes are on separate cache lines and each side keeps
+     * a cached copy of the other side index, so the shared index is read only
+     * when queue seems to be full/empty.
+     * @tparam T Type of stored elements.
+     */
+    template <class T>
+    class SpscQueue : public IQueue<T>
+    {
+        struct alignas(CacheLineSize) ProducerSide
+        {
+            std::atomic<size_t> tail{0}; // amount of enqueued items (next slot to write)
+            size_t cachedHead = 0; // last known value of ConsumerSide::head
+        };
+
+        struct alignas(CacheLineSize) ConsumerSide
+        {
+            std::atomic<size_t> head{0}; // amount of dequeued items (next slot to read)
+            size_t cachedTail = 0; // last known value of ProducerSide::tail
+            T lastDequeued; // dequeue() returns reference to it
+        };
+
+        const size_t QueueSize; // max amount of elements in the queue
+        const size_t IndexMask; // array size (power of two) - 1
+        T* array = nullptr;
+        T null_item; // element returned when queue is empty
+
+        ProducerSide producer;
+        ConsumerSide consumer;
+
+
+    public:
+        explicit SpscQueue(size_t queueSize)
+            : QueueSize(queueSize), IndexMask(roundUpToPowerOfTwo(queueSize) - 1)
+        {
+            if (QueueSize > 0)
+                array = new T[IndexMask + 1];
+        }
+
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+
+        ~SpscQueue()
+        {
+            delete[] array;
+        }
+
+
+        /**
+         * @brief Removes all elements. Can be called only by the consumer.
+         */
+        void clear() override
+        {
+            consumer.cachedTail = producer.tail.load(std::memory_order_acquire);
+            consumer.head.store(consumer.cachedTail, std::memory_order_release);
+        }
+
+
+        /**
+         * @brief Adds item to the end of the queue. Can be called only by the producer.
+         * @return false if queue is full.
+         */
+        bool enqueue(const T& item) override
+        {
+            size_t tail = producer.tail.load(std::memory_order_relaxed);
+
+            if (tail - producer.cachedHead == QueueSize)
+            {
+                producer.cachedHead = consumer.head.load(std::memory_order_acquire);
+                if (tail - producer.cachedHead == QueueSize)
+                    return false;
+            }
+
+            array[tail & IndexMask] = item;
+            producer.tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+
+        /**
+         * @brief Removes the first item from the queue and moves it to the output.
+         * Can be called only by the consumer.
+         * @param output [out] Place where dequeued item will be moved.
+         * @return false if queue is empty (output is unchanged).
+         */
+        bool tryDequeue(T& output)
+        {
+            size_t head = consumer.head.load(std::memory_order_relaxed);
+
+            if (head == consumer.cachedTail)
+            {
+                consumer.cachedTail = producer.tail.load(std::memory_order_acquire);
+                if (head == consumer.cachedTail)
+                    return false;
+            }
+
+            output = std::move(array[head & IndexMask]);
+            consumer.head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+
+        /**
+         * @brief Removes the first item from the queue. Can be called only by the consumer.
+         * @return Reference to the copy of dequeued item (valid until next dequeue() call)
+         * or null item if queue was empty.
+         */
+        T& dequeue() override
+        {
+            return tryDequeue(consumer.lastDequeued) ? consumer.lastDequeued : null_item;
+        }
+
+
+        /**
+         * @brief Can be called only by the consumer.
+         */
+        T& peek() override
+        {
+            size_t head = consumer.head.load(std::memory_order_relaxed);
+
+            if (head == consumer.cachedTail)
+            {
+                consumer.cachedTail = producer.tail.load(std::memory_order_acquire);
+                if (head == consumer.cachedTail)
+                    return null_item;
+            }
+
+            return array[head & IndexMask];
+        }
+
+
+        /**
+         * @brief Can be called only by the consumer.
+         */
+        const T& peek() const override
+        {
+            size_t head = consumer.head.load(std::memory_order_relaxed);
+            if (head == producer.tail.load(std::memory_order_acquire))
+                return null_item;
+
+            return array[head & IndexMask];
+        }
+
+
+        bool isEmpty() const override
+        {
+            return getQueueLength() == 0;
+        }
+
+
+        bool isFull() const override
+        {
+            return getQueueLength() == QueueSize;
+        }
+
+
+        size_t getQueueLength() const override
+        {
+            // head is read first, so it is never greater than tail
+            size_t head = consumer.head.load(std::memory_order_acquire);
+            size_t tail = producer.tail.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+
+    private:
+        static size_t roundUpToPowerOfTwo(size_t value)
+        {
+            size_t result = 1;
+            while (result < value)
+                result <<= 1;
+
+            return result;
+        }
+    };
+}
+
+
+#endif
@@ -0,0 +1,439 @@
+/**
+ * @file StaticInterfaces.h
+ * @author Jan Wielgus
+ * @brief Compile-time (CRTP) versions of the queue, list and array interfaces.
+ * Classes built on them have no virtual methods (no vtable pointer in the object)
+ * and calls in generic code are inlined. VirtualQueueAdapter, VirtualListAdapter
+ * and VirtualArrayAdapter add the virtual interfaces back when they are needed.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef STATICINTERFACES_H
+#define STATICINTERFACES_H
+
+#include "IRandomAccessQueue.h"
+#include "IArray.h"
+#include <type_traits>
+#include <utility>
+
+
+namespace SimpleDataStructures
+{
+    namespace Detail
+    {
+        template <class...>
+        struct MakeVoid
+        {
+            typedef void type;
+        };
+
+
+        /**
+         * @brief Only for decltype: class in which the method with the Signature
+         * (for example bool(const T&) or size_t() const) is declared.
+         */
+        template <class Signature, class Class>
+        Class memberOwner(Signature Class::*);
+    }
+
+
+
+    /**
+     * @brief Static counterpart of IQueue. Derived class has to implement all
+     * methods below (with the same signatures, without virtual).
+     * Generic code takes QueueInterface<Queue, T>& (or just Queue&) instead of IQueue<T>&,
+     * so the concrete type is known and calls are resolved at compile time.
+     * @tparam Derived Queue class that derives from this one.
+     * @tparam T Type of stored elements.
+     */
+    template <class Derived, class T>
+    class QueueInterface
+    {
+    public:
+        typedef T ValueType;
+
+        void clear() { derived().clear(); }
+        bool enqueue(const T& item) { return derived().enqueue(item); }
+        T& dequeue() { return derived().dequeue(); }
+        T& peek() { return derived().peek(); }
+        const T& peek() const { return derived().peek(); }
+        bool isEmpty() const { return derived().isEmpty(); }
+        bool isFull() const { return derived().isFull(); }
+        size_t getQueueLength() const { return derived().getQueueLength(); }
+
+        Derived& derived() { return static_cast<Derived&>(*this); }
+        constexpr const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+    protected:
+        // only as a base class (no virtual destructor)
+        constexpr QueueInterface()
+        {
+            // method that is not implemented in Derived would call itself through derived() forever
+            static_assert(!std::is_same<decltype(Detail::memberOwner<void()>(&Derived::clear)), QueueInterface>::value, "Queue has to implement clear()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool(const T&)>(&Derived::enqueue)), QueueInterface>::value, "Queue has to implement enqueue()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<T&()>(&Derived::dequeue)), QueueInterface>::value, "Queue has to implement dequeue()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<T&()>(&Derived::peek)), QueueInterface>::value, "Queue has to implement peek()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<const T&() const>(&Derived::peek)), QueueInterface>::value, "Queue has to implement peek() const");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool() const>(&Derived::isEmpty)), QueueInterface>::value, "Queue has to implement isEmpty()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool() const>(&Derived::isFull)), QueueInterface>::value, "Queue has to implement isFull()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<size_t() const>(&Derived::getQueueLength)), QueueInterface>::value, "Queue has to implement getQueueLength()");
+        }
+
+        constexpr QueueInterface(const QueueInterface&) = default;
+        QueueInterface& operator=(const QueueInterface&) = default;
+        ~QueueInterface() = default;
+    };
+
+
+
+    /**
+     * @brief Static counterpart of IList (see QueueInterface).
+     * @tparam Derived List class that derives from this one.
+     * @tparam T Type of stored elements.
+     */
+    template <class Derived, class T>
+    class ListInterface
+    {
+    public:
+        typedef T ValueType;
+
+        bool add(const T& item) { return derived().add(item); }
+        bool add(T&& item) { return derived().add(std::move(item)); }
+        bool add(const T& item, size_t index) { return derived().add(item, index); }
+        bool add(T&& item, size_t index) { return derived().add(std::move(item), index); }
+        bool remove(size_t index) { return derived().remove(index); }
+        T& get(size_t index) { return derived().get(index); }
+        const T& get(size_t index) const { return derived().get(index); }
+        T& operator[](size_t index) { return derived()[index]; }
+        const T& operator[](size_t index) const { return derived()[index]; }
+        bool replace(const T& newItem, size_t index) { return derived().replace(newItem, index); }
+        bool replace(T&& newItem, size_t index) { return derived().replace(std::move(newItem), index); }
+        size_t find(const T& itemToFind, size_t startIndex = 0) const { return derived().find(itemToFind, startIndex); }
+        bool contains(const T& itemToFind) const { return derived().contains(itemToFind); }
+        size_t size() const { return derived().size(); }
+        bool isEmpty() const { return derived().isEmpty(); }
+        void clear() { derived().clear(); }
+
+        Derived& derived() { return static_cast<Derived&>(*this); }
+        constexpr const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+    protected:
+        // only as a base class (no virtual destructor)
+        constexpr ListInterface()
+        {
+            // method that is not implemented in Derived would call itself through derived() forever
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool(const T&)>(&Derived::add)), ListInterface>::value, "List has to implement add(const T&)");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool(T&&)>(&Derived::add)), ListInterface>::value, "List has to implement add(T&&)");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool(const T&, size_t)>(&Derived::add)), ListInterface>::value, "List has to implement add(const T&, size_t)");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool(T&&, size_t)>(&Derived::add)), ListInterface>::value, "List has to implement add(T&&, size_t)");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool(size_t)>(&Derived::remove)), ListInterface>::value, "List has to implement remove()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<T&(size_t)>(&Derived::get)), ListInterface>::value, "List has to implement get()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<const T&(size_t) const>(&Derived::get)), ListInterface>::value, "List has to implement get() const");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<T&(size_t)>(&Derived::operator[])), ListInterface>::value, "List has to implement operator[]");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<const T&(size_t) const>(&Derived::operator[])), ListInterface>::value, "List has to implement operator[] const");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool(const T&, size_t)>(&Derived::replace)), ListInterface>::value, "List has to implement replace(const T&, size_t)");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool(T&&, size_t)>(&Derived::replace)), ListInterface>::value, "List has to implement replace(T&&, size_t)");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<size_t(const T&, size_t) const>(&Derived::find)), ListInterface>::value, "List has to implement find()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool(const T&) const>(&Derived::contains)), ListInterface>::value, "List has to implement contains()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<size_t() const>(&Derived::size)), ListInterface>::value, "List has to implement size()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool() const>(&Derived::isEmpty)), ListInterface>::value, "List has to implement isEmpty()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<void()>(&Derived::clear)), ListInterface>::value, "List has to implement clear()");
+        }
+
+        constexpr ListInterface(const ListInterface&) = default;
+        ListInterface& operator=(const ListInterface&) = default;
+        ~ListInterface() = default;
+    };
+
+
+
+    /**
+     * @brief Static counterpart of IArray (see QueueInterface).
+     * @tparam Derived Array class that derives from this one.
+     * @tparam T Type of stored elements.
+     */
+    template <class Derived, class T>
+    class ArrayInterface : public ListInterface<Derived, T>
+    {
+    public:
+        using ListInterface<Derived, T>::derived;
+
+        T* toArray() { return derived().toArray(); }
+        const T* toArray() const { return derived().toArray(); }
+        bool isFull() const { return derived().isFull(); }
+
+    protected:
+        constexpr ArrayInterface()
+        {
+            static_assert(!std::is_same<decltype(Detail::memberOwner<T*()>(&Derived::toArray)), ArrayInterface>::value, "Array has to implement toArray()");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<const T*() const>(&Derived::toArray)), ArrayInterface>::value, "Array has to implement toArray() const");
+            static_assert(!std::is_same<decltype(Detail::memberOwner<bool() const>(&Derived::isFull)), ArrayInterface>::value, "Array has to implement isFull()");
+        }
+
+        constexpr ArrayInterface(const ArrayInterface&) = default;
+        ArrayInterface& operator=(const ArrayInterface&) = default;
+        ~ArrayInterface() = default;
+    };
+
+
+
+    /**
+     * @brief Checks if Queue has all methods of the queue interface (used in static_assert
+     * of generic code). value is true for both static and virtual queues.
+     */
+    template <class Queue, class = void>
+    struct IsQueue : std::false_type
+    {
+    };
+
+
+    template <class Queue>
+    struct IsQueue<Queue, typename Detail::MakeVoid<
+        decltype(std::declval<Queue&>().clear()),
+        decltype(std::declval<Queue&>().enqueue(std::declval<const typename std::decay<decltype(std::declval<Queue&>().peek())>::type&>())),
+        decltype(std::declval<Queue&>().dequeue()),
+        decltype(std::declval<const Queue&>().peek()),
+        decltype(std::declval<const Queue&>().isEmpty()),
+        decltype(std::declval<const Queue&>().isFull()),
+        decltype(std::declval<const Queue&>().getQueueLength())>::type> : std::true_type
+    {
+    };
+
+
+
+    /**
+     * @brief Adds the virtual IRandomAccessQueue interface to the queue without one
+     * (opt-in, costs a vtable pointer in every object). Queue methods that are not
+     * in the interface are still available and not virtual.
+     * @tparam Queue Queue that implements QueueInterface, peek(index) and dequeue(index).
+     */
+    template <class Queue, class T = typename Queue::ValueType>
+    class VirtualQueueAdapter : public Queue, public IRandomAccessQueue<T>
+    {
+    public:
+        template <class... Args>
+        constexpr explicit VirtualQueueAdapter(Args&&... args)
+            : Queue(std::forward<Args>(args)...)
+        {
+        }
+
+
+        void clear() override
+        {
+            Queue::clear();
+        }
+
+
+        bool enqueue(const T& item) override
+        {
+            return Queue::enqueue(item);
+        }
+
+
+        T& dequeue() override
+        {
+            return Queue::dequeue();
+        }
+
+
+        T& dequeue(size_t index) override
+        {
+            return Queue::dequeue(index);
+        }
+
+
+        T& peek() override
+        {
+            return Queue::peek();
+        }
+
+
+        const T& peek() const override
+        {
+            return Queue::peek();
+        }
+
+
+        T& peek(size_t index) override
+        {
+            return Queue::peek(index);
+        }
+
+
+        const T& peek(size_t index) const override
+        {
+            return Queue::peek(index);
+        }
+
+
+        bool isEmpty() const override
+        {
+            return Queue::isEmpty();
+        }
+
+
+        bool isFull() const override
+        {
+            return Queue::isFull();
+        }
+
+
+        size_t getQueueLength() const override
+        {
+            return Queue::getQueueLength();
+        }
+    };
+
+
+
+    /**
+     * @brief Adds the virtual IList interface (or Interface derived from it) to the list
+     * without one, so it can be used for example with ListIterator (see VirtualQueueAdapter).
+     * @tparam List List that implements ListInterface.
+     */
+    template <class List, class T = typename List::ValueType, class Interface = IList<T>>
+    class VirtualListAdapter : public List, public Interface
+    {
+    public:
+        template <class... Args>
+        constexpr explicit VirtualListAdapter(Args&&... args)
+            : List(std::forward<Args>(args)...)
+        {
+        }
+
+
+        bool add(const T& item) override
+        {
+            return List::add(item);
+        }
+
+
+        bool add(T&& item) override
+        {
+            return List::add(std::move(item));
+        }
+
+
+        bool add(const T& item, size_t index) override
+        {
+            return List::add(item, index);
+        }
+
+
+        bool add(T&& item, size_t index) override
+        {
+            return List::add(std::move(item), index);
+        }
+
+
+        bool remove(size_t index) override
+        {
+            return List::remove(index);
+        }
+
+
+        T& get(size_t index) override
+        {
+            return List::get(index);
+        }
+
+
+        const T& get(size_t index) const override
+        {
+            return List::get(index);
+        }
+
+
+        T& operator[](size_t index) override
+        {
+            return List::operator[](index);
+        }
+
+
+        const T& operator[](size_t index) const override
+        {
+            return List::operator[](index);
+        }
+
+
+        bool replace(const T& newItem, size_t index) override
+        {
+            return List::replace(newItem, index);
+        }
+
+
+        bool replace(T&& newItem, size_t index) override
+        {
+            return List::replace(std::move(newItem), index);
+        }
+
+
+        size_t find(const T& itemToFind, size_t startIndex = 0) const override
+        {
+            return List::find(itemToFind, startIndex);
+        }
+
+
+        bool contains(const T& itemToFind) const override
+        {
+            return List::contains(itemToFind);
+        }
+
+
+        size_t size() const override
+        {
+            return List::size();
+        }
+
+
+        bool isEmpty() const override
+        {
+            return List::isEmpty();
+        }
+
+
+        void clear() override
+        {
+            List::clear();
+        }
+    };
+
+
+
+    /**
+     * @brief Adds the virtual IArray interface to the array without one.
+     * @tparam Array Array that implements ArrayInterface.
+     */
+    template <class Array, class T = typename Array::ValueType>
+    class VirtualArrayAdapter : public VirtualListAdapter<Array, T, IArray<T>>
+    {
+    public:
+        template <class... Args>
+        constexpr explicit VirtualArrayAdapter(Args&&... args)
+            : VirtualListAdapter<Array, T, IArray<T>>(std::forward<Args>(args)...)
+        {
+        }
+
+
+        T* toArray() override
+        {
+            return Array::toArray();
+        }
+
+
+        const T* toArray() const override
+        {
+            return Array::toArray();
+        }
+
+
+        bool isFull() const override
+        {
+            return Array::isFull();
+        }
+    };
+}
+
+
+#endif
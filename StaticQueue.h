@@ -2,7 +2,8 @@
  * @file StaticQueue.h
  * @author Jan Wielgus
  * @brief Queue that implement IQueue interface.
- * Queue size is provided in constructor and memory is allocated statically.
+ * Queue size is provided in constructor and memory is allocated statically
+ * or queue size is provided as a template argument and array is inside the object.
  * @date 2020-08-31
  * 
  */
@@ -10,21 +11,40 @@
 #ifndef STATICQUEUE_H
 #define STATICQUEUE_H
 
-#include "IQueue.h"
+#include "IRandomAccessQueue.h"
+#include "RingQueueBase.h"
 
 
 namespace SimpleDataStructures
 {
+    /**
+     * @brief Queue with fixed size.
+     * @tparam T Type of stored elements.
+     * @tparam Capacity Size of the queue known at compile time (array is stored
+     * inside the object, no heap is used). If 0 (default), size is provided
+     * in the constructor and array is allocated once on the heap.
+     */
+    template <class T, size_t Capacity = 0>
+    class StaticQueue;
+
+
+
+    /**
+     * @brief Queue with size provided in the constructor.
+     */
     template <class T>
-    class StaticQueue : public IQueue<T>
+    class StaticQueue<T, 0> : public RingQueueBase<StaticQueue<T, 0>, T>, public IRandomAccessQueue<T>
     {
+        typedef RingQueueBase<StaticQueue<T, 0>, T> Ring;
+        friend class RingQueueBase<StaticQueue<T, 0>, T>;
+
     protected:
         const size_t QueueSize; // size of the array
         T* array = nullptr;
-        T null_item; // element returned when queue is empty and dequeue() is called
-        
-        size_t queueFrontIndex = 0; // element to be dequeued in the first place
-        size_t queueLength = 0; // amount of elements in the queue
+
+        using Ring::null_item;
+        using Ring::queueFrontIndex;
+        using Ring::queueLength;
 
 
     public:
@@ -39,11 +59,8 @@ namespace SimpleDataStructures
 
 
         StaticQueue(const StaticQueue& other)
-            : QueueSize(other.QueueSize)
+            : Ring(other), QueueSize(other.QueueSize)
         {
-            queueFrontIndex = other.queueFrontIndex;
-            queueLength = other.queueLength;
-
             if (QueueSize > 0)
             {
                 array = new T[QueueSize];
@@ -69,68 +86,193 @@ namespace SimpleDataStructures
 
         void clear() override 
         {
-            queueFrontIndex = 0;
-            queueLength = 0;
+            Ring::clear();
         }
 
 
         virtual bool enqueue(const T& item) override
         {
-            if (QueueSize == 0)
-                return false;
-            
-            if (queueLength == QueueSize)
-                return false;
-            
-            size_t newItemIndex = (queueFrontIndex + queueLength) % QueueSize;
-            array[newItemIndex] = item;
-            queueLength++;
-            return true;
+            return Ring::enqueue(item);
         }
 
 
         virtual T& dequeue() override
         {
-            if (isEmpty())
-                return null_item;
-            
-            T& itemToReturn = array[queueFrontIndex];
-
-            queueLength--;
-            queueFrontIndex++; // move to the next item
-            queueFrontIndex %= QueueSize;
-
-            return itemToReturn;
+            return Ring::dequeue();
         }
 
 
         T& peek() override
         {
-            return isEmpty() ? null_item : array[queueFrontIndex];
+            return Ring::peek();
         }
 
 
         const T& peek() const override
         {
-            return isEmpty() ? null_item : array[queueFrontIndex];
+            return Ring::peek();
+        }
+
+
+        /**
+         * @brief Removes item at the index. Elements before it are moved one place back,
+         * so this is fastest for elements close to the queue beginning.
+         * @param index Index of an item to dequeue (0 is the first element).
+         * @return Reference to the dequeued item (valid until the next modification)
+         * or null item if index is out of bounds.
+         */
+        T& dequeue(size_t index) override
+        {
+            return Ring::dequeue(index);
+        }
+
+
+        T& peek(size_t index) override
+        {
+            return Ring::peek(index);
+        }
+
+
+        const T& peek(size_t index) const override
+        {
+            return Ring::peek(index);
         }
 
 
         bool isEmpty() const override
         {
-            return queueLength == 0;
+            return Ring::isEmpty();
         }
 
 
         bool isFull() const override
         {
-            return queueLength == QueueSize;
+            return Ring::isFull();
         }
 
 
         size_t getQueueLength() const override
         {
-            return queueLength;
+            return Ring::getQueueLength();
+        }
+
+
+        /**
+         * @return Size of the queue.
+         */
+        size_t getCapacity() const
+        {
+            return QueueSize;
+        }
+
+
+    protected:
+        T* getArray()
+        {
+            return array;
+        }
+
+
+        const T* getArray() const
+        {
+            return array;
+        }
+
+
+        /**
+         * @brief Wrap index that went past the end of the array to its beginning.
+         * Faster than modulo (no division).
+         * @param index Index lower than 2 * QueueSize.
+         */
+        size_t wrapIndex(size_t index) const
+        {
+            return index >= QueueSize ? index - QueueSize : index;
+        }
+    };
+
+
+
+    /**
+     * @brief Queue with size known at compile time, without virtual methods
+     * (implements the static QueueInterface, so there is no vtable pointer
+     * and calls are always inlined). Use StaticQueue<T, Capacity> if the IQueue
+     * or IRandomAccessQueue interface is needed.
+     * Doesn't use the heap and can be constructed at compile time (constexpr).
+     * When Capacity is a power of two, indexes are wrapped with a bitmask.
+     */
+    template <class T, size_t Capacity>
+    class RingQueue : public RingQueueBase<RingQueue<T, Capacity>, T>
+    {
+        friend class RingQueueBase<RingQueue<T, Capacity>, T>;
+
+        static_assert(Capacity > 0, "Capacity have to be greater than zero (use StaticQueue<T> for size provided at runtime)");
+
+    protected:
+        static constexpr bool IsCapacityPowerOfTwo = (Capacity & (Capacity - 1)) == 0;
+
+        T array[Capacity];
+
+
+    public:
+        constexpr RingQueue()
+            : array{}
+        {
+        }
+
+
+        constexpr RingQueue(const RingQueue& other) = default;
+        RingQueue& operator=(const RingQueue& other) = default;
+
+
+        /**
+         * @return Size of the queue.
+         */
+        static constexpr size_t getCapacity()
+        {
+            return Capacity;
+        }
+
+
+    protected:
+        T* getArray()
+        {
+            return array;
+        }
+
+
+        const T* getArray() const
+        {
+            return array;
+        }
+
+
+        /**
+         * @brief Wrap index that went past the end of the array to its beginning.
+         * Uses bitmask if Capacity is power of two, compare otherwise.
+         * @param index Index lower than 2 * Capacity.
+         */
+        static constexpr size_t wrapIndex(size_t index)
+        {
+            return IsCapacityPowerOfTwo ? (index & (Capacity - 1))
+                : (index >= Capacity ? index - Capacity : index);
+        }
+    };
+
+
+
+    /**
+     * @brief Queue with size known at compile time that implements IRandomAccessQueue
+     * (RingQueue with the virtual interface added by VirtualQueueAdapter).
+     * Doesn't use the heap. Constructor is constexpr, so global queues are constant
+     * initialized (no static initialization order problems, constinit in C++20),
+     * but the virtual interface makes the type non-literal: use RingQueue for constexpr objects.
+     */
+    template <class T, size_t Capacity>
+    class StaticQueue : public VirtualQueueAdapter<RingQueue<T, Capacity>>
+    {
+    public:
+        constexpr StaticQueue()
+        {
         }
     };
 }
@@ -18,6 +18,7 @@ namespace SimpleDataStructures
     class StaticSinkingQueue : public StaticQueue<T>
     {
     protected:
+        using StaticQueue<T>::wrapIndex;
         using StaticQueue<T>::QueueSize;
         using StaticQueue<T>::array;
         using StaticQueue<T>::null_item;
@@ -53,15 +54,14 @@ namespace SimpleDataStructures
                 return false;
 
             // queueEndIndex is index to put the new item
-            size_t queueEndIndex = (queueFrontIndex + queueLength) % QueueSize;
+            size_t queueEndIndex = wrapIndex(queueFrontIndex + queueLength);
             array[queueEndIndex] = item;
 
             // queue is full, overwrite the oldest item
             if (queueLength == QueueSize)
             {
                 // overwrite the oldest item
-                queueFrontIndex++;
-                queueFrontIndex %= QueueSize;
+                queueFrontIndex = wrapIndex(queueFrontIndex + 1);
             }
             else // queue is not full
                 queueLength++;
@@ -70,34 +70,30 @@ namespace SimpleDataStructures
         }
 
 
-
-
-
-
-
-        /*
-
-        // TODO: this method goes to class that implement IRandomAccessQueue interface
-        T& peek(size_t index) override
+        /**
+         * @brief Adds all items to the end of the queue. If there is not enough place,
+         * the oldest items are overwritten (only the last QueueSize items are kept
+         * if amount is greater than the queue size).
+         * @param items Pointer to the first item to add.
+         * @param amount Amount of items to add.
+         * @return Amount of items that were added (amount or 0 if queue size is 0).
+         */
+        size_t enqueueBulk(const T* items, size_t amount)
         {
-            if (index >= queueLength)
-                return null_item;
-            
-            size_t returnIndex = (queueFrontIndex + index) % QueueSize;
-            return array[returnIndex];
-        }
+            if (QueueSize == 0)
+                return 0;
 
+            size_t toSkip = amount > QueueSize ? amount - QueueSize : 0;
+            size_t toCopy = amount - toSkip;
 
-        const T& peek(size_t index) const override
-        {
-            if (index >= queueLength)
-                return null_item;
-            
-            size_t returnIndex = (queueFrontIndex + index) % QueueSize;
-            return array[returnIndex];
-        }
+            // remove the oldest items to make place for the new ones
+            size_t freeSlots = QueueSize - queueLength;
+            if (toCopy > freeSlots)
+                this->discard(toCopy - freeSlots);
 
-        */
+            StaticQueue<T>::enqueueBulk(items + toSkip, toCopy);
+            return amount;
+        }
     };
 }
 
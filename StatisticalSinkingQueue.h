@@ -0,0 +1,460 @@
+/**
+ * @file StatisticalSinkingQueue.h
+ * @author Jan Wielgus
+ * @brief Sinking queue that keeps statistics (mean, variance, min, max)
+ * of its elements up to date in O(1) time per element.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef STATISTICALSINKINGQUEUE_H
+#define STATISTICALSINKINGQUEUE_H
+
+#include "StaticSinkingQueue.h"
+#include <type_traits>
+#include <stdint.h>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Sliding window over the last QueueSize samples.
+     * Sum and sum of squares are updated on every enqueue/dequeue
+     * (with compensated summation for floating point accumulators), and minimum
+     * and maximum are tracked by monotonic deques, so mean(), variance(),
+     * min() and max() are O(1) instead of O(window).
+     * Samples can be only read, because changing them would bypass the statistics
+     * (that's why the queue is kept inside instead of being a base class).
+     * @tparam T Arithmetic type of samples.
+     */
+    template <class T>
+    class StatisticalSinkingQueue
+    {
+        static_assert(std::is_arithmetic<T>::value, "StatisticalSinkingQueue works only with arithmetic types");
+
+        // Integers are summed exactly while the result fits in int64_t for every window size
+        // (sum of up to 32 bit samples, squares of up to 16 bit samples),
+        // otherwise in double with compensation.
+        typedef typename std::conditional<std::is_integral<T>::value && sizeof(T) <= 4, int64_t, double>::type SumAccumulator;
+        typedef typename std::conditional<std::is_integral<T>::value && sizeof(T) <= 2, int64_t, double>::type SquareAccumulator;
+
+
+    private:
+        /**
+         * @brief Compensated (Kahan-Babuska) sum. Compensation is used only for floating point accumulators.
+         */
+        template <class Accumulator>
+        class RunningSum
+        {
+            Accumulator sum = 0;
+            Accumulator compensation = 0;
+
+        public:
+            void add(Accumulator value)
+            {
+                if (std::is_integral<Accumulator>::value)
+                {
+                    sum += value;
+                    return;
+                }
+
+                Accumulator newSum = sum + value;
+                if ((sum >= 0 ? sum : -sum) >= (value >= 0 ? value : -value))
+                    compensation += (sum - newSum) + value;
+                else
+                    compensation += (value - newSum) + sum;
+                sum = newSum;
+            }
+
+            Accumulator get() const
+            {
+                return sum + compensation;
+            }
+
+            void reset()
+            {
+                sum = 0;
+                compensation = 0;
+            }
+        };
+
+
+        /**
+         * @brief Deque of window elements in which values are monotonic
+         * (front is the minimum if Greater is false, maximum otherwise).
+         * Elements are identified by the sequence number of enqueue.
+         */
+        template <bool Greater>
+        class MonotonicDeque
+        {
+            struct Entry
+            {
+                size_t sequence;
+                T value;
+            };
+
+            Entry* entries = nullptr;
+            size_t dequeSize = 0;
+            size_t front = 0;
+            size_t length = 0;
+
+        public:
+            explicit MonotonicDeque(size_t dequeSize)
+                : dequeSize(dequeSize)
+            {
+                if (dequeSize > 0)
+                    entries = new Entry[dequeSize];
+            }
+
+            MonotonicDeque(const MonotonicDeque& other)
+                : MonotonicDeque(other.dequeSize)
+            {
+                front = other.front;
+                length = other.length;
+                for (size_t i = 0; i < dequeSize; i++)
+                    entries[i] = other.entries[i];
+            }
+
+            MonotonicDeque& operator=(const MonotonicDeque&) = delete;
+
+            ~MonotonicDeque()
+            {
+                delete[] entries;
+            }
+
+            /**
+             * @brief Add new element, remove elements that will never be the front.
+             */
+            void push(size_t sequence, T value)
+            {
+                while (length > 0 && !isBetter(entries[backIndex()].value, value))
+                    length--;
+
+                entries[wrap(front + length)] = { sequence, value };
+                length++;
+            }
+
+            /**
+             * @brief Should be called when element with the sequence number leaves the window.
+             */
+            void remove(size_t sequence)
+            {
+                if (length > 0 && entries[front].sequence == sequence)
+                {
+                    front = wrap(front + 1);
+                    length--;
+                }
+            }
+
+            const T& getFront() const
+            {
+                return entries[front].value;
+            }
+
+            void clear()
+            {
+                front = 0;
+                length = 0;
+            }
+
+        private:
+            size_t backIndex() const
+            {
+                return wrap(front + length - 1);
+            }
+
+            size_t wrap(size_t index) const
+            {
+                return index >= dequeSize ? index - dequeSize : index;
+            }
+
+            // true if a should stay in front of b
+            static bool isBetter(const T& a, const T& b)
+            {
+                return Greater ? a > b : a < b;
+            }
+        };
+
+
+        StaticSinkingQueue<T> window;
+        RunningSum<SumAccumulator> sum;
+        RunningSum<SquareAccumulator> sumOfSquares;
+        MonotonicDeque<false> minDeque;
+        MonotonicDeque<true> maxDeque;
+        size_t enqueuedAmount = 0; // sequence number of the next enqueued element
+
+
+    public:
+        StatisticalSinkingQueue(size_t queueSize)
+            : window(queueSize), minDeque(queueSize), maxDeque(queueSize)
+        {
+        }
+
+
+        StatisticalSinkingQueue(const StatisticalSinkingQueue& other) = default;
+        StatisticalSinkingQueue& operator=(const StatisticalSinkingQueue& other) = delete;
+
+
+        void clear()
+        {
+            window.clear();
+            sum.reset();
+            sumOfSquares.reset();
+            minDeque.clear();
+            maxDeque.clear();
+        }
+
+
+        /**
+         * @brief Adds new sample. If queue is full, the oldest sample is removed.
+         */
+        bool enqueue(const T& item)
+        {
+            if (window.getCapacity() == 0)
+                return false;
+
+            if (window.isFull())
+                forgetFrontItem();
+
+            window.enqueue(item);
+
+            sum.add((SumAccumulator)item);
+            sumOfSquares.add((SquareAccumulator)item * (SquareAccumulator)item);
+            minDeque.push(enqueuedAmount, item);
+            maxDeque.push(enqueuedAmount, item);
+            enqueuedAmount++;
+
+            return true;
+        }
+
+
+        /**
+         * @brief Removes the oldest sample.
+         * @return The removed sample (null item if empty).
+         */
+        const T& dequeue()
+        {
+            if (window.isEmpty())
+                return window.dequeue();
+
+            forgetFrontItem();
+            return window.dequeue();
+        }
+
+
+        /**
+         * @brief Removes sample at the index. Minimum and maximum have to be
+         * recomputed, so this takes O(window) time.
+         */
+        const T& dequeue(size_t index)
+        {
+            if (index >= window.getQueueLength())
+                return window.dequeue(index);
+
+            const T& item = window.peek(index);
+            sum.add(-(SumAccumulator)item);
+            sumOfSquares.add(-((SquareAccumulator)item * (SquareAccumulator)item));
+
+            const T& dequeued = window.dequeue(index);
+            rebuildExtremes();
+            return dequeued;
+        }
+
+
+        size_t enqueueBulk(const T* items, size_t amount)
+        {
+            for (size_t i = 0; i < amount; i++)
+                enqueue(items[i]);
+
+            return window.getCapacity() == 0 ? 0 : amount;
+        }
+
+
+        size_t dequeueBulk(T* output, size_t amount)
+        {
+            size_t dequeued = 0;
+            for (; dequeued < amount && !window.isEmpty(); dequeued++)
+                output[dequeued] = dequeue();
+
+            return dequeued;
+        }
+
+
+        size_t discard(size_t amount)
+        {
+            size_t discarded = 0;
+            for (; discarded < amount && !window.isEmpty(); discarded++)
+                dequeue();
+
+            return discarded;
+        }
+
+
+        const T& peek() const
+        {
+            return window.peek();
+        }
+
+
+        const T& peek(size_t index) const
+        {
+            return window.peek(index);
+        }
+
+
+        bool isEmpty() const
+        {
+            return window.isEmpty();
+        }
+
+
+        bool isFull() const
+        {
+            return window.isFull();
+        }
+
+
+        size_t getQueueLength() const
+        {
+            return window.getQueueLength();
+        }
+
+
+        size_t getCapacity() const
+        {
+            return window.getCapacity();
+        }
+
+
+        /**
+         * @brief Read-only access to samples (from the oldest one), see StaticQueue.
+         */
+        TwoPartSpan<const T> getSpans() const
+        {
+            return window.getSpans();
+        }
+
+
+        RingIterator<const T> begin() const
+        {
+            return window.begin();
+        }
+
+
+        RingIterator<const T> end() const
+        {
+            return window.end();
+        }
+
+
+        template <class Function>
+        void forEach(Function&& function) const
+        {
+            window.forEach(function);
+        }
+
+
+        template <class Result, class Function>
+        Result reduce(Result init, Function&& function) const
+        {
+            return window.reduce(init, function);
+        }
+
+
+        template <class Predicate>
+        size_t countIf(Predicate&& predicate) const
+        {
+            return window.countIf(predicate);
+        }
+
+
+        /**
+         * @return Arithmetic mean of samples in the queue (0 if empty).
+         */
+        double mean() const
+        {
+            size_t length = window.getQueueLength();
+            return length == 0 ? 0 : (double)sum.get() / length;
+        }
+
+
+        /**
+         * @return Population variance of samples in the queue (0 if empty).
+         */
+        double variance() const
+        {
+            size_t length = window.getQueueLength();
+            if (length == 0)
+                return 0;
+
+            double average = mean();
+            double result = (double)sumOfSquares.get() / length - average * average;
+            return result > 0 ? result : 0; // rounding errors can make it slightly negative
+        }
+
+
+        /**
+         * @return The smallest sample in the queue (null item if empty).
+         */
+        const T& min() const
+        {
+            return window.isEmpty() ? window.peek() : minDeque.getFront();
+        }
+
+
+        /**
+         * @return The biggest sample in the queue (null item if empty).
+         */
+        const T& max() const
+        {
+            return window.isEmpty() ? window.peek() : maxDeque.getFront();
+        }
+
+
+        /**
+         * @return Sum of samples in the queue.
+         */
+        SumAccumulator getSum() const
+        {
+            return sum.get();
+        }
+
+
+    private:
+        /**
+         * @brief Remove the first element from statistics (before it leaves the queue).
+         */
+        void forgetFrontItem()
+        {
+            const T& front = window.peek();
+            size_t frontSequence = enqueuedAmount - window.getQueueLength();
+
+            sum.add(-(SumAccumulator)front);
+            sumOfSquares.add(-((SquareAccumulator)front * (SquareAccumulator)front));
+            minDeque.remove(frontSequence);
+            maxDeque.remove(frontSequence);
+        }
+
+
+        /**
+         * @brief Fill min and max deques again with all elements from the queue.
+         */
+        void rebuildExtremes()
+        {
+            minDeque.clear();
+            maxDeque.clear();
+
+            size_t length = window.getQueueLength();
+            size_t firstSequence = enqueuedAmount - length;
+            for (size_t i = 0; i < length; i++)
+            {
+                const T& item = window.peek(i);
+                minDeque.push(firstSequence + i, item);
+                maxDeque.push(firstSequence + i, item);
+            }
+        }
+    };
+}
+
+
+#endif
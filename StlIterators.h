@@ -0,0 +1,160 @@
+/**
+ * @file StlIterators.h
+ * @author Jan Wielgus
+ * @brief Non-virtual iterators compatible with the STL (range-based for loop, <algorithm>).
+ * Returned by begin() and end() methods of data structures.
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef STLITERATORS_H
+#define STLITERATORS_H
+
+#include <iterator>
+#include <type_traits>
+#include <stddef.h>
+
+
+namespace SimpleDataStructures
+{
+    /**
+     * @brief Forward iterator that walks through the nodes using their next pointer.
+     * @tparam T Type of elements (const T for const iterator).
+     * @tparam NodeType Type of nodes with data and next fields (const for const iterator).
+     */
+    template <class T, class NodeType>
+    class NodeWalker
+    {
+        NodeType* node = nullptr;
+
+        template <class, class>
+        friend class NodeWalker;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename std::remove_const<T>::type value_type;
+        typedef ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        NodeWalker() {}
+
+        explicit NodeWalker(NodeType* node)
+            : node(node)
+        {
+        }
+
+        /**
+         * @brief Conversion from the mutable to the const iterator.
+         */
+        template <class OtherT, class OtherNodeType,
+            class = typename std::enable_if<std::is_convertible<OtherNodeType*, NodeType*>::value>::type>
+        NodeWalker(const NodeWalker<OtherT, OtherNodeType>& other)
+            : node(other.node)
+        {
+        }
+
+        T& operator*() const { return node->data; }
+        T* operator->() const { return &node->data; }
+
+        NodeWalker& operator++()
+        {
+            node = node->next;
+            return *this;
+        }
+
+        NodeWalker operator++(int)
+        {
+            NodeWalker previous = *this;
+            node = node->next;
+            return previous;
+        }
+
+        // friends, so the mutable iterator is converted whichever side it is on
+        friend bool operator==(const NodeWalker& a, const NodeWalker& b) { return a.node == b.node; }
+        friend bool operator!=(const NodeWalker& a, const NodeWalker& b) { return a.node != b.node; }
+    };
+
+
+
+    /**
+     * @brief Random access iterator over the ring buffer elements (from the queue front).
+     * Remembers only the position from the front, index in the array
+     * is computed when element is accessed.
+     * @tparam T Type of elements (const T for const iterator).
+     */
+    template <class T>
+    class RingIterator
+    {
+        T* array = nullptr;
+        size_t arraySize = 0;
+        size_t frontIndex = 0;
+        ptrdiff_t position = 0; // from the front element
+
+        template <class>
+        friend class RingIterator;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::remove_const<T>::type value_type;
+        typedef ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        RingIterator() {}
+
+        /**
+         * @param array Ring buffer.
+         * @param arraySize Size of the ring buffer.
+         * @param frontIndex Index of the first element in the array.
+         * @param position Position of the element from the front.
+         */
+        RingIterator(T* array, size_t arraySize, size_t frontIndex, size_t position)
+            : array(array), arraySize(arraySize), frontIndex(frontIndex), position((ptrdiff_t)position)
+        {
+        }
+
+        /**
+         * @brief Conversion from the mutable to the const iterator.
+         */
+        template <class OtherT, class = typename std::enable_if<std::is_convertible<OtherT*, T*>::value>::type>
+        RingIterator(const RingIterator<OtherT>& other)
+            : array(other.array), arraySize(other.arraySize), frontIndex(other.frontIndex), position(other.position)
+        {
+        }
+
+        T& operator*() const { return array[wrap(position)]; }
+        T* operator->() const { return &array[wrap(position)]; }
+        T& operator[](ptrdiff_t offset) const { return array[wrap(position + offset)]; }
+
+        RingIterator& operator++() { position++; return *this; }
+        RingIterator& operator--() { position--; return *this; }
+        RingIterator operator++(int) { RingIterator previous = *this; position++; return previous; }
+        RingIterator operator--(int) { RingIterator previous = *this; position--; return previous; }
+        RingIterator& operator+=(ptrdiff_t offset) { position += offset; return *this; }
+        RingIterator& operator-=(ptrdiff_t offset) { position -= offset; return *this; }
+
+        RingIterator operator+(ptrdiff_t offset) const { RingIterator result = *this; return result += offset; }
+        RingIterator operator-(ptrdiff_t offset) const { RingIterator result = *this; return result -= offset; }
+        friend RingIterator operator+(ptrdiff_t offset, const RingIterator& iterator) { return iterator + offset; }
+
+        // friends, so the mutable iterator is converted whichever side it is on
+        friend ptrdiff_t operator-(const RingIterator& a, const RingIterator& b) { return a.position - b.position; }
+        friend bool operator==(const RingIterator& a, const RingIterator& b) { return a.position == b.position; }
+        friend bool operator!=(const RingIterator& a, const RingIterator& b) { return a.position != b.position; }
+        friend bool operator<(const RingIterator& a, const RingIterator& b) { return a.position < b.position; }
+        friend bool operator>(const RingIterator& a, const RingIterator& b) { return a.position > b.position; }
+        friend bool operator<=(const RingIterator& a, const RingIterator& b) { return a.position <= b.position; }
+        friend bool operator>=(const RingIterator& a, const RingIterator& b) { return a.position >= b.position; }
+
+    private:
+        size_t wrap(ptrdiff_t offset) const
+        {
+            size_t index = frontIndex + (size_t)offset;
+            return index >= arraySize ? index - arraySize : index;
+        }
+    };
+}
+
+
+#endif
@@ -0,0 +1,740 @@
+/**
+ * @file UnrolledList.h
+ * @author Jan Wielgus
+ * @brief Linked list that stores several elements in every node (block).
+ * @date 2026-10-17
+ *
+ */
+
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+
+#include "IList.h"
+#include <new>
+#include <utility>
+
+
+namespace SimpleDataStructures
+{
+    template <class T, size_t BlockSize>
+    class UnrolledList;
+
+
+
+    /**
+     * @brief Block of the UnrolledList. Stores up to BlockSize elements
+     * in uninitialized storage (only [0, count) are constructed).
+     */
+    template <class T, size_t BlockSize>
+    class UnrolledListBlock
+    {
+    public:
+        UnrolledListBlock<T, BlockSize>* prev = nullptr;
+        UnrolledListBlock<T, BlockSize>* next = nullptr;
+        size_t count = 0;
+
+    private:
+        alignas(T) unsigned char storage[BlockSize * sizeof(T)];
+
+    public:
+        T* elements()
+        {
+            return reinterpret_cast<T*>(storage);
+        }
+
+        const T* elements() const
+        {
+            return reinterpret_cast<const T*>(storage);
+        }
+    };
+
+
+
+    /**
+     * @brief Iterator only for the UnrolledList.
+     * Goes through elements of each block as through an array.
+     */
+    template <class T, size_t BlockSize = 16>
+    class UnrolledListIterator : public Iterator<T>
+    {
+        UnrolledListBlock<T, BlockSize>* block = nullptr;
+        size_t nextIndexInBlock = 0;
+        T nullElement;
+
+    public:
+        UnrolledListIterator(const UnrolledList<T, BlockSize>& list)
+        {
+            reset(list);
+        }
+
+        UnrolledListIterator(const UnrolledListIterator&) = delete;
+        UnrolledListIterator& operator=(const UnrolledListIterator&) = delete;
+
+
+        UnrolledListIterator(UnrolledListIterator&& toMove)
+        {
+            block = toMove.block;
+            nextIndexInBlock = toMove.nextIndexInBlock;
+            toMove.block = nullptr;
+        }
+
+
+        UnrolledListIterator& operator=(UnrolledListIterator&& toMove)
+        {
+            if (this != &toMove)
+            {
+                block = toMove.block;
+                nextIndexInBlock = toMove.nextIndexInBlock;
+                toMove.block = nullptr;
+            }
+
+            return *this;
+        }
+
+
+        bool hasNext() override
+        {
+            return block != nullptr;
+        }
+
+
+        T& next() override
+        {
+            if (block == nullptr)
+                return nullElement;
+
+            T& toReturn = block->elements()[nextIndexInBlock++];
+
+            if (nextIndexInBlock == block->count)
+            {
+                block = block->next;
+                nextIndexInBlock = 0;
+            }
+
+            return toReturn;
+        }
+
+
+        /**
+         * @brief Iterator won't have next elements from now.
+         */
+        void reset()
+        {
+            block = nullptr;
+        }
+
+
+        /**
+         * @brief Sets iterator at the beginning of the passed list.
+         */
+        void reset(const UnrolledList<T, BlockSize>& list)
+        {
+            block = list.root;
+            nextIndexInBlock = 0;
+        }
+    };
+
+
+
+
+    /**
+     * @brief Linked list of blocks, each block stores up to BlockSize elements.
+     * Iterating is almost as fast as through an array (one pointer per block)
+     * and adding/removing in the middle moves at most BlockSize elements.
+     * Full blocks are split on insertion. Blocks less than half full are merged
+     * with a neighbour on removal or borrow elements from it, so every block
+     * that lost an element has at least BlockSize / 2 elements.
+     * @tparam T Type of stored elements.
+     * @tparam BlockSize Maximum amount of elements in one block.
+     */
+    template <class T, size_t BlockSize = 16>
+    class UnrolledList : public IList<T>
+    {
+        static_assert(BlockSize >= 2, "BlockSize have to be at least 2");
+
+        typedef UnrolledListBlock<T, BlockSize> Block;
+
+        Block* root = nullptr;
+        Block* tail = nullptr;
+        size_t listSize = 0;
+
+        Block* cachedBlock = nullptr;
+        size_t cachedBlockStartIndex = 0; // index of the first element in the cached block
+
+        T nullElement; // element returned for example when used get() on empty list
+
+        friend class UnrolledListIterator<T, BlockSize>;
+
+
+    public:
+        UnrolledList() {}
+
+
+        UnrolledList(const UnrolledList& other)
+        {
+            setFrom(other);
+        }
+
+
+        UnrolledList(UnrolledList&& toMove)
+        {
+            takeBlocksFrom(toMove);
+        }
+
+
+        ~UnrolledList()
+        {
+            clear();
+        }
+
+
+        UnrolledList& operator=(const UnrolledList& other)
+        {
+            if (this != &other)
+                setFrom(other);
+
+            return *this;
+        }
+
+
+        UnrolledList& operator=(UnrolledList&& toMove)
+        {
+            if (this != &toMove)
+            {
+                clear();
+                takeBlocksFrom(toMove);
+            }
+
+            return *this;
+        }
+
+
+        bool add(const T& item) override
+        {
+            return emplace(item);
+        }
+
+
+        bool add(T&& item) override
+        {
+            return emplace(std::move(item));
+        }
+
+
+        bool add(const T& item, size_t index) override
+        {
+            return emplaceAt(index, item);
+        }
+
+
+        bool add(T&& item, size_t index) override
+        {
+            return emplaceAt(index, std::move(item));
+        }
+
+
+        /**
+         * @brief Construct new item at the end of the list.
+         * @param args Arguments passed to the T constructor.
+         * @return true (list is never full).
+         */
+        template <class... Args>
+        bool emplace(Args&&... args)
+        {
+            if (tail == nullptr || tail->count == BlockSize)
+                insertBlockAfter(tail);
+
+            new (tail->elements() + tail->count) T(std::forward<Args>(args)...);
+            tail->count++;
+            listSize++;
+
+            return true;
+        }
+
+
+        /**
+         * @brief Construct new item at the specified index.
+         * If the block is full, it is split into two blocks.
+         * @param index Index where to construct new item.
+         * @param args Arguments passed to the T constructor.
+         * @return false if index is out of bounds.
+         */
+        template <class... Args>
+        bool emplaceAt(size_t index, Args&&... args)
+        {
+            if (index > listSize)
+                return false;
+
+            if (index == listSize)
+                return emplace(std::forward<Args>(args)...);
+
+            T newItem(std::forward<Args>(args)...); // args can be moved by shifting
+
+            size_t indexInBlock;
+            Block* block = findBlock(index, indexInBlock);
+
+            if (block->count == BlockSize)
+            {
+                Block* newBlock = splitBlock(block);
+
+                if (indexInBlock > block->count)
+                {
+                    indexInBlock -= block->count;
+                    block = newBlock;
+                }
+            }
+
+            // Make place for a new item
+            T* elements = block->elements();
+            if (indexInBlock == block->count)
+                new (elements + indexInBlock) T(std::move(newItem));
+            else
+            {
+                new (elements + block->count) T(std::move(elements[block->count - 1]));
+                for (size_t i = block->count - 1; i > indexInBlock; i--)
+                    elements[i] = std::move(elements[i - 1]);
+
+                elements[indexInBlock] = std::move(newItem);
+            }
+
+            block->count++;
+            listSize++;
+            cachedBlock = nullptr;
+
+            return true;
+        }
+
+
+        /**
+         * @brief Remove element at specified index.
+         * If block becomes less than half full, it is merged with the previous or the next
+         * block (if fits) or borrows elements from the bigger neighbour.
+         * @param index Index of element to be removed from the list.
+         * @return true if element was removed. Return false if list is empty
+         * or index is out of bounds.
+         */
+        bool remove(size_t index) override
+        {
+            if (index >= listSize)
+                return false;
+
+            size_t indexInBlock;
+            Block* block = findBlock(index, indexInBlock);
+
+            T* elements = block->elements();
+            for (size_t i = indexInBlock + 1; i < block->count; i++)
+                elements[i - 1] = std::move(elements[i]);
+
+            elements[block->count - 1].~T();
+            block->count--;
+            listSize--;
+            cachedBlock = nullptr;
+
+            if (block->count == 0)
+                removeBlock(block);
+            else if (block->count < BlockSize / 2)
+                rebalance(block);
+
+            return true;
+        }
+
+
+        T& get(size_t index) override
+        {
+            T* toReturn = getElement(index);
+            return toReturn == nullptr ? nullElement : *toReturn;
+        }
+
+
+        const T& get(size_t index) const override
+        {
+            T* toReturn = getElement(index);
+            return toReturn == nullptr ? nullElement : *toReturn;
+        }
+
+
+        T& operator[](size_t index) override
+        {
+            T* toReturn = getElement(index);
+            return toReturn == nullptr ? nullElement : *toReturn;
+        }
+
+
+        const T& operator[](size_t index) const override
+        {
+            T* toReturn = getElement(index);
+            return toReturn == nullptr ? nullElement : *toReturn;
+        }
+
+
+        bool replace(const T& newItem, size_t index) override
+        {
+            T* toReplace = getElement(index);
+
+            if (toReplace == nullptr)
+                return false;
+
+            *toReplace = newItem;
+            return true;
+        }
+
+
+        bool replace(T&& newItem, size_t index) override
+        {
+            T* toReplace = getElement(index);
+
+            if (toReplace == nullptr)
+                return false;
+
+            *toReplace = std::move(newItem);
+            return true;
+        }
+
+
+        size_t find(const T& itemToFind, size_t startIndex = 0) const override
+        {
+            if (startIndex >= listSize)
+                return npos;
+
+            size_t indexInBlock;
+            Block* block = findBlock(startIndex, indexInBlock);
+            size_t blockStartIndex = startIndex - indexInBlock;
+
+            for (; block != nullptr; block = block->next)
+            {
+                const T* elements = block->elements();
+                for (size_t i = indexInBlock; i < block->count; i++)
+                    if (elements[i] == itemToFind)
+                        return blockStartIndex + i;
+
+                blockStartIndex += block->count;
+                indexInBlock = 0;
+            }
+
+            return npos;
+        }
+
+
+        bool contains(const T& itemToFind) const override
+        {
+            return find(itemToFind) != npos;
+        }
+
+
+        size_t size() const override
+        {
+            return listSize;
+        }
+
+
+        bool isEmpty() const override
+        {
+            return listSize == 0;
+        }
+
+
+        void clear() override
+        {
+            Block* block = root;
+            while (block != nullptr)
+            {
+                Block* next = block->next;
+                destroyElements(block);
+                delete block;
+                block = next;
+            }
+
+            root = nullptr;
+            tail = nullptr;
+            listSize = 0;
+            cachedBlock = nullptr;
+        }
+
+
+        /**
+         * @return Amount of allocated blocks.
+         */
+        size_t getBlocksAmount() const
+        {
+            size_t amount = 0;
+            for (Block* block = root; block != nullptr; block = block->next)
+                amount++;
+
+            return amount;
+        }
+
+
+        /**
+         * @return Amount of elements in the block at blockIndex (0 if there is no such block).
+         */
+        size_t getBlockLength(size_t blockIndex) const
+        {
+            Block* block = root;
+            for (size_t i = 0; i < blockIndex && block != nullptr; i++)
+                block = block->next;
+
+            return block == nullptr ? 0 : block->count;
+        }
+
+
+
+    private:
+        T* getElement(size_t index) const
+        {
+            if (index >= listSize)
+                return nullptr;
+
+            size_t indexInBlock;
+            Block* block = findBlock(index, indexInBlock);
+            return block->elements() + indexInBlock;
+        }
+
+
+        /**
+         * @brief Find block that contains element at the index.
+         * Search starts from the tail, cached block or the root. Found block is cached.
+         * @param index Index of the element (have to be less than size).
+         * @param indexInBlock [out] Position of the element inside the returned block.
+         */
+        Block* findBlock(size_t index, size_t& indexInBlock) const
+        {
+            Block* block = root;
+            size_t blockStartIndex = 0;
+
+            if (index >= listSize - tail->count)
+            {
+                indexInBlock = index - (listSize - tail->count);
+                return tail;
+            }
+
+            if (cachedBlock != nullptr && cachedBlockStartIndex <= index)
+            {
+                block = cachedBlock;
+                blockStartIndex = cachedBlockStartIndex;
+            }
+
+            while (index >= blockStartIndex + block->count)
+            {
+                blockStartIndex += block->count;
+                block = block->next;
+            }
+
+            // Store new cached block
+            const_cast<UnrolledList*>(this)->cachedBlock = block;
+            const_cast<UnrolledList*>(this)->cachedBlockStartIndex = blockStartIndex;
+
+            indexInBlock = index - blockStartIndex;
+            return block;
+        }
+
+
+        /**
+         * @brief Allocate new empty block and link it after the passed one
+         * (or at the beginning if passed nullptr).
+         */
+        Block* insertBlockAfter(Block* block)
+        {
+            Block* newBlock = new Block;
+            newBlock->prev = block;
+            newBlock->next = block == nullptr ? root : block->next;
+
+            if (newBlock->next == nullptr)
+                tail = newBlock;
+            else
+                newBlock->next->prev = newBlock;
+
+            if (block == nullptr)
+                root = newBlock;
+            else
+                block->next = newBlock;
+
+            return newBlock;
+        }
+
+
+        void removeBlock(Block* block)
+        {
+            if (block->prev == nullptr)
+                root = block->next;
+            else
+                block->prev->next = block->next;
+
+            if (block->next == nullptr)
+                tail = block->prev;
+            else
+                block->next->prev = block->prev;
+
+            destroyElements(block);
+            delete block;
+            cachedBlock = nullptr;
+        }
+
+
+        /**
+         * @brief Move the second half of the full block to the new block after it.
+         * @return Pointer to the new block.
+         */
+        Block* splitBlock(Block* block)
+        {
+            Block* newBlock = insertBlockAfter(block);
+            size_t firstHalf = block->count / 2;
+            moveElements(block, firstHalf, newBlock);
+            return newBlock;
+        }
+
+
+        /**
+         * @brief Move all elements from the next block to the block and remove the next block.
+         */
+        void mergeWithNextBlock(Block* block)
+        {
+            Block* next = block->next;
+            T* nextElements = next->elements();
+
+            for (size_t i = 0; i < next->count; i++)
+                new (block->elements() + block->count + i) T(std::move(nextElements[i]));
+
+            block->count += next->count;
+            removeBlock(next);
+        }
+
+
+        /**
+         * @brief Restore at least BlockSize / 2 elements in the block that is less than half full.
+         * Block is merged with the previous or the next one if both fit in one block,
+         * otherwise it borrows elements from the bigger neighbour (both have at least half after that).
+         */
+        void rebalance(Block* block)
+        {
+            Block* prev = block->prev;
+            Block* next = block->next;
+
+            if (prev != nullptr && prev->count + block->count <= BlockSize)
+                mergeWithNextBlock(prev);
+            else if (next != nullptr && block->count + next->count <= BlockSize)
+                mergeWithNextBlock(block);
+            else if (next != nullptr && (prev == nullptr || next->count >= prev->count))
+                borrowFromNextBlock(block, (next->count - block->count) / 2);
+            else if (prev != nullptr)
+                borrowFromPreviousBlock(block, (prev->count - block->count) / 2);
+        }
+
+
+        /**
+         * @brief Move the first amount of elements from the next block to the end of the block.
+         */
+        void borrowFromNextBlock(Block* block, size_t amount)
+        {
+            Block* next = block->next;
+            T* elements = block->elements();
+            T* nextElements = next->elements();
+
+            for (size_t i = 0; i < amount; i++)
+                new (elements + block->count + i) T(std::move(nextElements[i]));
+            block->count += amount;
+
+            for (size_t i = amount; i < next->count; i++)
+                nextElements[i - amount] = std::move(nextElements[i]);
+            for (size_t i = next->count - amount; i < next->count; i++)
+                nextElements[i].~T();
+            next->count -= amount;
+        }
+
+
+        /**
+         * @brief Move the last amount of elements from the previous block to the beginning of the block.
+         */
+        void borrowFromPreviousBlock(Block* block, size_t amount)
+        {
+            Block* prev = block->prev;
+            T* elements = block->elements();
+            T* prevElements = prev->elements();
+
+            // Make place at the beginning (positions >= count are not constructed yet)
+            for (size_t i = block->count; i-- > 0;)
+            {
+                if (i + amount >= block->count)
+                    new (elements + i + amount) T(std::move(elements[i]));
+                else
+                    elements[i + amount] = std::move(elements[i]);
+            }
+
+            size_t firstBorrowed = prev->count - amount;
+            for (size_t i = 0; i < amount; i++)
+            {
+                if (i < block->count)
+                    elements[i] = std::move(prevElements[firstBorrowed + i]);
+                else
+                    new (elements + i) T(std::move(prevElements[firstBorrowed + i]));
+
+                prevElements[firstBorrowed + i].~T();
+            }
+
+            block->count += amount;
+            prev->count = firstBorrowed;
+        }
+
+
+        /**
+         * @brief Move elements [from, count) of the source block to the end of destination block.
+         */
+        void moveElements(Block* source, size_t from, Block* destination)
+        {
+            T* sourceElements = source->elements();
+            T* destinationElements = destination->elements();
+
+            for (size_t i = from; i < source->count; i++)
+            {
+                new (destinationElements + destination->count) T(std::move(sourceElements[i]));
+                destination->count++;
+                sourceElements[i].~T();
+            }
+
+            source->count = from;
+        }
+
+
+        static void destroyElements(Block* block)
+        {
+            T* elements = block->elements();
+            for (size_t i = 0; i < block->count; i++)
+                elements[i].~T();
+
+            block->count = 0;
+        }
+
+
+        /**
+         * @brief Clear the list and make a deep copy of data from other.
+         * @param other UnrolledList to make a deep copy.
+         */
+        void setFrom(const UnrolledList& other)
+        {
+            clear();
+
+            for (Block* block = other.root; block != nullptr; block = block->next)
+                for (size_t i = 0; i < block->count; i++)
+                    emplace(block->elements()[i]);
+        }
+
+
+        /**
+         * @brief Take all blocks from the other (this list have to be empty).
+         * @param toMove UnrolledList to take elements from. Will be empty after that.
+         */
+        void takeBlocksFrom(UnrolledList& toMove)
+        {
+            root = toMove.root;
+            tail = toMove.tail;
+            listSize = toMove.listSize;
+
+            toMove.root = nullptr;
+            toMove.tail = nullptr;
+            toMove.listSize = 0;
+            toMove.cachedBlock = nullptr;
+        }
+    };
+}
+
+
+#endif
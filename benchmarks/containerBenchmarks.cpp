@@ -0,0 +1,357 @@
+/**
+ * Micro-benchmarks of the containers against their std equivalents.
+ * Results are printed to stdout as CSV (one line per measurement, stable order),
+ * so runs can be saved and compared with diff or a spreadsheet.
+ * Progress and notes are printed to stderr.
+ *
+ * Usage: containerBenchmarks [maxN] [maxBytes]
+ *   maxN      Biggest amount of elements (default 10000000).
+ *   maxBytes  Sizes for which N * element size is bigger are skipped (default 268435456).
+ *
+ * Columns: container,operation,element_bytes,n,ns_per_op
+ *   append          add N elements at the end (ns per element)
+ *   insert_middle   add element in the middle of N elements (ns per insertion)
+ *   remove_middle   remove element from the middle of N elements (ns per removal)
+ *   get             indexed access to all N elements in order (ns per element)
+ *   find            search for a missing element among N elements (ns per search)
+ *   iterate         range-based for over N elements (ns per element)
+ *   enqueue_dequeue enqueue + dequeue pair on a half full queue of capacity N (ns per pair)
+ */
+
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <list>
+#include <deque>
+#include <algorithm>
+#include <cstdlib>
+#include <stdint.h>
+#include "../GrowingArray.h"
+#include "../LinkedList.h"
+#include "../StaticQueue.h"
+#include "../StaticSinkingQueue.h"
+
+using namespace std;
+using namespace SimpleDataStructures;
+
+
+static const size_t ElementsPerMeasurement = 1 << 20; // small containers are measured in many copies
+static const size_t LinearWork = 4096; // elements moved by O(n) operations in small containers
+
+static uint64_t checksum = 0; // results are added here, so the compiler can't remove the work
+
+
+/**
+ * @brief Element of the given size. Only the key is compared.
+ */
+template <size_t Bytes>
+struct Element
+{
+    uint32_t key = 0;
+    char payload[Bytes - sizeof(uint32_t)] = {};
+
+    Element() {}
+    explicit Element(uint32_t key) : key(key) {}
+
+    bool operator==(const Element& other) const { return key == other.key; }
+    bool operator!=(const Element& other) const { return key != other.key; }
+};
+
+
+inline uint32_t keyOf(int item) { return (uint32_t)item; }
+
+template <size_t Bytes>
+inline uint32_t keyOf(const Element<Bytes>& item) { return item.key; }
+
+template <class T>
+inline T makeItem(size_t key) { return T((uint32_t)key); }
+
+template <>
+inline int makeItem<int>(size_t key) { return (int)key; }
+
+
+// Containers behind the same set of methods (everything is inlined, no virtual calls).
+
+template <class T>
+struct GrowingArrayBench
+{
+    static const char* name() { return "GrowingArray"; }
+    static const bool HasIndexedGet = true;
+    GrowingArray<T> c;
+
+    void append(const T& item) { c.add(item); }
+    void insertMiddle(const T& item) { c.add(item, c.size() / 2); }
+    void removeMiddle() { c.remove(c.size() / 2); }
+    const T& get(size_t index) { return c[index]; }
+    bool find(const T& item) { return c.find(item) != npos; }
+    size_t size() const { return c.size(); }
+};
+
+
+template <class T>
+struct VectorBench
+{
+    static const char* name() { return "std::vector"; }
+    static const bool HasIndexedGet = true;
+    vector<T> c;
+
+    void append(const T& item) { c.push_back(item); }
+    void insertMiddle(const T& item) { c.insert(c.begin() + c.size() / 2, item); }
+    void removeMiddle() { c.erase(c.begin() + c.size() / 2); }
+    const T& get(size_t index) { return c[index]; }
+    bool find(const T& item) { return std::find(c.begin(), c.end(), item) != c.end(); }
+    size_t size() const { return c.size(); }
+};
+
+
+template <class T>
+struct LinkedListBench
+{
+    static const char* name() { return "LinkedList"; }
+    static const bool HasIndexedGet = true;
+    LinkedList<T> c;
+
+    void append(const T& item) { c.add(item); }
+    void insertMiddle(const T& item) { c.add(item, c.size() / 2); }
+    void removeMiddle() { c.remove(c.size() / 2); }
+    const T& get(size_t index) { return c[index]; }
+    bool find(const T& item) { return c.find(item) != npos; }
+    size_t size() const { return c.size(); }
+};
+
+
+template <class T>
+struct ListBench
+{
+    static const char* name() { return "std::list"; }
+    static const bool HasIndexedGet = false; // no operator[], walking from the beginning every time is O(n^2)
+    list<T> c;
+
+    void append(const T& item) { c.push_back(item); }
+    void insertMiddle(const T& item) { c.insert(next(c.begin(), c.size() / 2), item); }
+    void removeMiddle() { c.erase(next(c.begin(), c.size() / 2)); }
+    const T& get(size_t) { return c.front(); }
+    bool find(const T& item) { return std::find(c.begin(), c.end(), item) != c.end(); }
+    size_t size() const { return c.size(); }
+};
+
+
+template <class T>
+struct DequeBench
+{
+    static const char* name() { return "std::deque"; }
+    static const bool HasIndexedGet = true;
+    deque<T> c;
+
+    explicit DequeBench(size_t = 0) {}
+
+    void append(const T& item) { c.push_back(item); }
+    void insertMiddle(const T& item) { c.insert(c.begin() + c.size() / 2, item); }
+    void removeMiddle() { c.erase(c.begin() + c.size() / 2); }
+    const T& get(size_t index) { return c[index]; }
+    bool find(const T& item) { return std::find(c.begin(), c.end(), item) != c.end(); }
+    size_t size() const { return c.size(); }
+
+    bool enqueue(const T& item) { c.push_back(item); return true; }
+    T dequeue() { T item = c.front(); c.pop_front(); return item; }
+};
+
+
+template <class T>
+struct StaticQueueBench
+{
+    static const char* name() { return "StaticQueue"; }
+    StaticQueue<T> c;
+
+    explicit StaticQueueBench(size_t capacity) : c(capacity) {}
+
+    bool enqueue(const T& item) { return c.enqueue(item); }
+    const T& dequeue() { return c.dequeue(); }
+};
+
+
+template <class T>
+struct StaticSinkingQueueBench
+{
+    static const char* name() { return "StaticSinkingQueue"; }
+    StaticSinkingQueue<T> c;
+
+    explicit StaticSinkingQueueBench(size_t capacity) : c(capacity) {}
+
+    bool enqueue(const T& item) { return c.enqueue(item); }
+    const T& dequeue() { return c.dequeue(); }
+};
+
+
+
+void printResult(const char* container, const char* operation, size_t elementBytes, size_t n, double nsPerOperation)
+{
+    cout << container << "," << operation << "," << elementBytes << "," << n << "," << nsPerOperation << endl;
+}
+
+
+/**
+ * @brief Measure operation on many instances of the container at once (about
+ * ElementsPerMeasurement elements in total), so small sizes are not dominated by the timer.
+ * @param setup Function that prepares an instance (not measured).
+ * @param operation Function that does the measured work on an instance.
+ * @param operationsPerInstance Amount of operations done by one call of operation.
+ * @return Nanoseconds per operation.
+ */
+template <class Bench, class Setup, class Operation>
+double measure(size_t n, Setup setup, Operation operation, size_t operationsPerInstance)
+{
+    size_t instancesAmount = max<size_t>(1, ElementsPerMeasurement / n);
+    vector<unique_ptr<Bench>> instances;
+    instances.reserve(instancesAmount);
+    for (size_t i = 0; i < instancesAmount; i++)
+    {
+        instances.emplace_back(new Bench());
+        setup(*instances.back());
+    }
+
+    auto start = chrono::steady_clock::now();
+    for (auto& instance : instances)
+        operation(*instance);
+    chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+
+    return elapsed.count() / (double)(instancesAmount * operationsPerInstance);
+}
+
+
+template <class T, class Bench>
+void fill(Bench& bench, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        bench.append(makeItem<T>(i));
+}
+
+
+template <class T, template <class> class BenchTemplate>
+void benchmarkList(size_t n)
+{
+    typedef BenchTemplate<T> Bench;
+    const char* name = Bench::name();
+    auto prefill = [n](Bench& bench) { fill<T>(bench, n); };
+    size_t linearOperations = max<size_t>(1, LinearWork / n);
+
+    printResult(name, "append", sizeof(T), n, measure<Bench>(n,
+        [](Bench&) {},
+        [n](Bench& bench) { fill<T>(bench, n); }, n));
+
+    printResult(name, "insert_middle", sizeof(T), n, measure<Bench>(n, prefill,
+        [linearOperations](Bench& bench) {
+            for (size_t i = 0; i < linearOperations; i++)
+                bench.insertMiddle(makeItem<T>(i));
+            checksum += bench.size();
+        }, linearOperations));
+
+    size_t removals = min(linearOperations, n / 2 > 0 ? n / 2 : 1);
+    printResult(name, "remove_middle", sizeof(T), n, measure<Bench>(n, prefill,
+        [removals](Bench& bench) {
+            for (size_t i = 0; i < removals; i++)
+                bench.removeMiddle();
+            checksum += bench.size();
+        }, removals));
+
+    if (Bench::HasIndexedGet)
+        printResult(name, "get", sizeof(T), n, measure<Bench>(n, prefill,
+            [n](Bench& bench) {
+                uint64_t sum = 0;
+                for (size_t i = 0; i < n; i++)
+                    sum += keyOf(bench.get(i));
+                checksum += sum;
+            }, n));
+
+    T missing = makeItem<T>(n + 1);
+    printResult(name, "find", sizeof(T), n, measure<Bench>(n, prefill,
+        [linearOperations, &missing](Bench& bench) {
+            for (size_t i = 0; i < linearOperations; i++)
+                checksum += bench.find(missing) ? 1 : 0;
+        }, linearOperations));
+
+    printResult(name, "iterate", sizeof(T), n, measure<Bench>(n, prefill,
+        [](Bench& bench) {
+            uint64_t sum = 0;
+            for (const T& item : bench.c)
+                sum += keyOf(item);
+            checksum += sum;
+        }, n));
+}
+
+
+template <class T, template <class> class BenchTemplate>
+void benchmarkQueue(size_t n)
+{
+    typedef BenchTemplate<T> Bench;
+    size_t instancesAmount = max<size_t>(1, ElementsPerMeasurement / n);
+    vector<unique_ptr<Bench>> instances;
+    instances.reserve(instancesAmount);
+    for (size_t i = 0; i < instancesAmount; i++)
+    {
+        instances.emplace_back(new Bench(n));
+        for (size_t j = 0; j < n / 2; j++)
+            instances.back()->enqueue(makeItem<T>(j));
+    }
+
+    // steady state: front moves around the whole array
+    auto start = chrono::steady_clock::now();
+    for (auto& instance : instances)
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            instance->enqueue(makeItem<T>(i));
+            sum += keyOf(instance->dequeue());
+        }
+        checksum += sum;
+    }
+    chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+
+    printResult(Bench::name(), "enqueue_dequeue", sizeof(T), n, elapsed.count() / (double)(instancesAmount * n));
+}
+
+
+template <class T>
+void benchmarkElementSize(size_t maxN, size_t maxBytes)
+{
+    const size_t sizes[] = { 16, 256, 4096, 65536, 1048576, 10000000 };
+
+    for (size_t n : sizes)
+    {
+        if (n > maxN)
+            break;
+
+        if (n * sizeof(T) > maxBytes)
+        {
+            cerr << "skipping " << sizeof(T) << " byte elements, n = " << n << " (more than " << maxBytes << " bytes)" << endl;
+            continue;
+        }
+
+        cerr << sizeof(T) << " byte elements, n = " << n << endl;
+        benchmarkList<T, GrowingArrayBench>(n);
+        benchmarkList<T, VectorBench>(n);
+        benchmarkList<T, LinkedListBench>(n);
+        benchmarkList<T, ListBench>(n);
+        benchmarkList<T, DequeBench>(n);
+        benchmarkQueue<T, StaticQueueBench>(n);
+        benchmarkQueue<T, StaticSinkingQueueBench>(n);
+        benchmarkQueue<T, DequeBench>(n);
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    size_t maxN = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t maxBytes = argc > 2 ? strtoull(argv[2], nullptr, 10) : (size_t)1 << 28;
+
+    cout << "container,operation,element_bytes,n,ns_per_op" << endl;
+    benchmarkElementSize<int>(maxN, maxBytes);
+    benchmarkElementSize<Element<16>>(maxN, maxBytes);
+    benchmarkElementSize<Element<64>>(maxN, maxBytes);
+
+    cerr << "(checksum " << checksum << ")" << endl;
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include "../StaticSinkingQueue.h"
+#include "../FirFilter.h"
+
+using namespace std;
+using namespace SimpleDataStructures;
+
+
+static const int SamplesAmount = 200000;
+
+
+/**
+ * @brief Convolution computed like before: scalar loop over peek(index) of the sinking queue.
+ */
+float scalarQueueFilter(StaticSinkingQueue<float>& queue, const float* coefficients, size_t windowSize, float sample)
+{
+    queue.enqueue(sample);
+
+    float result = 0;
+    for (size_t k = 0; k < windowSize; k++)
+        result += coefficients[k] * queue.peek(windowSize - 1 - k);
+
+    return result;
+}
+
+
+/**
+ * @brief Filter SamplesAmount samples with both implementations.
+ * Prints throughput in millions of samples per second.
+ */
+void measureWindow(size_t windowSize, const float* input)
+{
+    float* coefficients = new float[windowSize];
+    for (size_t i = 0; i < windowSize; i++)
+        coefficients[i] = 1.0f / (i + 1);
+
+    StaticSinkingQueue<float> queue(windowSize);
+    for (size_t i = 0; i < windowSize; i++)
+        queue.enqueue(0);
+    FirFilter<float> filter(coefficients, windowSize);
+
+    float queueChecksum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < SamplesAmount; i++)
+        queueChecksum += scalarQueueFilter(queue, coefficients, windowSize, input[i]);
+    chrono::duration<double> queueTime = chrono::steady_clock::now() - start;
+
+    float filterChecksum = 0;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < SamplesAmount; i++)
+        filterChecksum += filter.filter(input[i]);
+    chrono::duration<double> filterTime = chrono::steady_clock::now() - start;
+
+    cout << windowSize << "\t" << SamplesAmount / queueTime.count() / 1e6
+        << "\t\t\t" << SamplesAmount / filterTime.count() / 1e6
+        << "\t\t(checksums " << queueChecksum << ", " << filterChecksum << ")" << endl;
+
+    delete[] coefficients;
+}
+
+
+int main()
+{
+    float* input = new float[SamplesAmount];
+    for (int i = 0; i < SamplesAmount; i++)
+        input[i] = (rand() % 2001 - 1000) / 100.0f;
+
+#if defined(__AVX__)
+    cout << "FIR filter (AVX kernel), M samples/s" << endl;
+#elif defined(__SSE__)
+    cout << "FIR filter (SSE kernel), M samples/s" << endl;
+#else
+    cout << "FIR filter (scalar kernel), M samples/s" << endl;
+#endif
+    cout << "taps\tsinking queue + peek\tFirFilter" << endl;
+
+    for (size_t windowSize = 8; windowSize <= 512; windowSize *= 4)
+        measureWindow(windowSize, input);
+
+    delete[] input;
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <chrono>
+#include <stdint.h>
+#include "../GrowingArray.h"
+
+using namespace std;
+using namespace SimpleDataStructures;
+
+
+static const int Repeats = 20000;
+
+
+/**
+ * @brief Search for the last element (whole array is scanned) with the scalar loop
+ * and with GrowingArray::find() (vectorized).
+ * Prints throughput in millions of elements per second.
+ */
+template <class T>
+void measureFind(const char* typeName, size_t length)
+{
+    GrowingArray<T> array(length);
+    for (size_t i = 0; i < length; i++)
+        array.add((T)(i % 100));
+    array.replace((T)101, length - 1);
+
+    const T* elements = array.toArray();
+    const T needle = (T)101;
+    size_t checksum = 0;
+
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < Repeats; r++)
+    {
+        checksum += SimdKernels::findScalar(elements, length, needle);
+        asm volatile("" : : "r"(elements) : "memory"); // don't let the compiler hoist the search
+    }
+    chrono::duration<double> scalarTime = chrono::steady_clock::now() - start;
+
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < Repeats; r++)
+    {
+        checksum += array.find(needle);
+        asm volatile("" : : "r"(elements) : "memory");
+    }
+    chrono::duration<double> simdTime = chrono::steady_clock::now() - start;
+
+    double elementsAmount = (double)length * Repeats / 1e6;
+    cout << typeName << "\t" << length << "\t" << elementsAmount / scalarTime.count()
+        << "\t\t" << elementsAmount / simdTime.count()
+        << "\t\t" << scalarTime.count() / simdTime.count() << "x"
+        << "\t(checksum " << checksum << ")" << endl;
+}
+
+
+int main()
+{
+#if defined(__AVX2__)
+    cout << "find() with AVX2, M elements/s" << endl;
+#elif defined(__SSE2__)
+    cout << "find() with SSE2, M elements/s" << endl;
+#else
+    cout << "find() without SIMD, M elements/s" << endl;
+#endif
+    cout << "type\tlength\tscalar loop\tGrowingArray::find\tspeedup" << endl;
+
+    for (size_t length = 16; length <= 4096; length *= 4)
+    {
+        measureFind<uint8_t>("uint8", length);
+        measureFind<uint16_t>("uint16", length);
+        measureFind<uint32_t>("uint32", length);
+        measureFind<float>("float", length);
+        measureFind<double>("double", length);
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+#include "../HashMap.h"
+
+using namespace std;
+using namespace SimpleDataStructures;
+
+
+static const int KeysAmount = 100000;
+static const int Repeats = 10;
+
+
+/**
+ * @brief Measure time of the operation in nanoseconds per key.
+ */
+template <class Operation>
+double measure(Operation operation)
+{
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < Repeats; r++)
+        operation();
+    chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count() / Repeats / KeysAmount;
+}
+
+
+/**
+ * @brief Insert, find (hits and misses) and erase all keys.
+ * Map adapters make the same calls for HashMap/StaticHashMap and std::unordered_map.
+ */
+template <class Map, class Insert, class Find, class Erase>
+void measureMap(const char* name, Map& map, const vector<int>& keys, const vector<int>& missingKeys,
+    Insert insert, Find find, Erase erase)
+{
+    long long checksum = 0;
+
+    double insertTime = measure([&]() {
+        map.clear();
+        for (int key : keys)
+            insert(map, key, key);
+    });
+
+    double findTime = measure([&]() {
+        for (int key : keys)
+            checksum += find(map, key);
+    });
+
+    double missTime = measure([&]() {
+        for (int key : missingKeys)
+            checksum += find(map, key);
+    });
+
+    double eraseTime = measure([&]() {
+        for (int key : keys)
+            erase(map, key);
+        for (int key : keys)
+            insert(map, key, key); // restore for the next repeat (included in time)
+    });
+
+    cout << name << "\t" << insertTime << "\t" << findTime << "\t" << missTime
+        << "\t" << eraseTime << "\t(checksum " << checksum << ")" << endl;
+}
+
+
+int main()
+{
+    vector<int> keys;
+    vector<int> missingKeys;
+    srand(1);
+    for (int i = 0; i < KeysAmount; i++)
+    {
+        keys.push_back(rand() * 2); // even keys are in the map
+        missingKeys.push_back(rand() * 2 + 1);
+    }
+
+    auto insertHashMap = [](IMap<int, int>& map, int key, int value) { map.set(key, value); };
+    auto findHashMap = [](IMap<int, int>& map, int key) { const int* value = map.find(key); return value ? *value : 0; };
+    auto eraseHashMap = [](IMap<int, int>& map, int key) { map.erase(key); };
+
+    cout << "ns per key (" << KeysAmount << " random int keys)" << endl;
+    cout << "map\t\tinsert\tfind\tmiss\terase+insert" << endl;
+
+    unordered_map<int, int> stdMap;
+    measureMap("unordered_map", stdMap, keys, missingKeys,
+        [](unordered_map<int, int>& map, int key, int value) { map[key] = value; },
+        [](unordered_map<int, int>& map, int key) { auto found = map.find(key); return found != map.end() ? found->second : 0; },
+        [](unordered_map<int, int>& map, int key) { map.erase(key); });
+
+    HashMap<int, int> hashMap;
+    measureMap("HashMap\t", hashMap, keys, missingKeys,
+        [](HashMap<int, int>& map, int key, int value) { map.set(key, value); },
+        [](HashMap<int, int>& map, int key) { const int* value = map.find(key); return value ? *value : 0; },
+        [](HashMap<int, int>& map, int key) { map.erase(key); });
+
+    static StaticHashMap<int, int, KeysAmount> staticHashMap;
+    measureMap("StaticHashMap", staticHashMap, keys, missingKeys,
+        [](StaticHashMap<int, int, KeysAmount>& map, int key, int value) { map.set(key, value); },
+        [](StaticHashMap<int, int, KeysAmount>& map, int key) { const int* value = map.find(key); return value ? *value : 0; },
+        [](StaticHashMap<int, int, KeysAmount>& map, int key) { map.erase(key); });
+
+    HashMap<int, int> virtualCallsMap;
+    measureMap("HashMap (IMap&)", virtualCallsMap, keys, missingKeys, insertHashMap, findHashMap, eraseHashMap);
+
+    return 0;
+}
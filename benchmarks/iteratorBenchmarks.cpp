@@ -0,0 +1,128 @@
+#include <iostream>
+#include <chrono>
+#include <numeric>
+#include "../GrowingArray.h"
+#include "../LinkedList.h"
+#include "../StaticQueue.h"
+#include "../ArrayIterator.h"
+
+using namespace std;
+using namespace SimpleDataStructures;
+
+
+static const int ElementsAmount = 10000;
+static const int Repeats = 2000;
+
+
+/**
+ * @brief Run sumFunction Repeats times.
+ * @return Nanoseconds per element.
+ */
+template <class SumFunction>
+double measure(SumFunction sumFunction, long long& checksum)
+{
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < Repeats; r++)
+        checksum += sumFunction();
+    chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count() / Repeats / ElementsAmount;
+}
+
+
+/**
+ * @brief Sum all elements with virtual hasNext()/next() calls.
+ * Not inlined, so the compiler doesn't know the iterator type and can't devirtualize the calls
+ * (like when iterator is passed through the interface in the real code).
+ */
+template <class T>
+__attribute__((noinline)) long long sumWithIterator(Iterator<T>& iterator)
+{
+    long long sum = 0;
+    while (iterator.hasNext())
+        sum += iterator.next();
+    return sum;
+}
+
+
+/**
+ * @brief Sum all elements with virtual peek(index) calls.
+ */
+template <class T>
+__attribute__((noinline)) long long sumWithPeek(IRandomAccessQueue<T>& queue)
+{
+    long long sum = 0;
+    for (size_t i = 0; i < queue.getQueueLength(); i++)
+        sum += queue.peek(i);
+    return sum;
+}
+
+
+void printResult(const char* name, double virtualTime, double stlTime, double reduceTime)
+{
+    cout << name << "\t" << virtualTime << "\t\t\t" << stlTime << "\t\t\t" << reduceTime
+        << "\t\t" << virtualTime / stlTime << "x / " << virtualTime / reduceTime << "x" << endl;
+}
+
+
+int main()
+{
+    GrowingArray<int> array;
+    LinkedList<int> list;
+    StaticQueue<int> queue(ElementsAmount);
+    for (int i = 0; i < ElementsAmount; i++)
+    {
+        array.add(i);
+        list.add(i);
+        queue.enqueue(i);
+    }
+
+    long long checksum = 0;
+    cout << "Sum of " << ElementsAmount << " ints, ns per element" << endl;
+    cout << "container\tvirtual iterator / peek\tbegin()/end() (range-for)\treduce()\tspeedup (range-for / reduce)" << endl;
+    auto add = [](long long sum, int item) { return sum + item; };
+
+    double virtualTime = measure([&array]() {
+        ArrayIterator<int> iterator(array);
+        return sumWithIterator<int>(iterator);
+    }, checksum);
+    double stlTime = measure([&array]() {
+        long long sum = 0;
+        for (int item : array)
+            sum += item;
+        return sum;
+    }, checksum);
+    double reduceTime = measure([&array, add]() {
+        return array.reduce(0LL, add);
+    }, checksum);
+    printResult("GrowingArray", virtualTime, stlTime, reduceTime);
+
+    virtualTime = measure([&list]() {
+        LinkedListIterator<int> iterator(list);
+        return sumWithIterator<int>(iterator);
+    }, checksum);
+    stlTime = measure([&list]() {
+        return accumulate(list.begin(), list.end(), 0LL);
+    }, checksum);
+    reduceTime = measure([&list, add]() {
+        return list.reduce(0LL, add);
+    }, checksum);
+    printResult("LinkedList", virtualTime, stlTime, reduceTime);
+
+    // queues have no virtual iterator, so indexed peek through the interface is used
+    virtualTime = measure([&queue]() {
+        return sumWithPeek<int>(queue);
+    }, checksum);
+    stlTime = measure([&queue]() {
+        long long sum = 0;
+        for (int item : queue)
+            sum += item;
+        return sum;
+    }, checksum);
+    reduceTime = measure([&queue, add]() {
+        return queue.reduce(0LL, add);
+    }, checksum);
+    printResult("StaticQueue", virtualTime, stlTime, reduceTime);
+
+    cout << "(checksum " << checksum << ")" << endl;
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <chrono>
+#include "../StaticQueue.h"
+#include "../GrowingArray.h"
+#include "../LinkedList.h"
+
+using namespace std;
+using namespace SimpleDataStructures;
+
+
+static const int QueueCapacity = 64;
+static const int Operations = 10000;
+static const int Repeats = 2000;
+static const int ListSize = 1000;
+
+
+/**
+ * @brief Run function Repeats times.
+ * @return Nanoseconds per one of operationsPerCall operations
+ * (enqueue + dequeue pairs by default).
+ */
+template <class Function>
+double measure(Function function, long long& checksum, int operationsPerCall = Operations)
+{
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < Repeats; r++)
+        checksum += function();
+    chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count() / Repeats / operationsPerCall;
+}
+
+
+/**
+ * @brief Pass elements through the queue with virtual calls.
+ * Not inlined, so the compiler doesn't know the queue type and can't devirtualize the calls
+ * (like when queue is passed through the interface in the real code).
+ */
+__attribute__((noinline)) long long passThroughVirtual(IQueue<int>& queue)
+{
+    long long sum = 0;
+    for (int i = 0; i < Operations; i++)
+    {
+        queue.enqueue(i);
+        if (queue.getQueueLength() > QueueCapacity / 2)
+            sum += queue.dequeue();
+    }
+    queue.clear();
+    return sum;
+}
+
+
+/**
+ * @brief The same through the static interface (calls are inlined).
+ */
+template <class Queue>
+__attribute__((noinline)) long long passThroughStatic(QueueInterface<Queue, int>& queue)
+{
+    long long sum = 0;
+    for (int i = 0; i < Operations; i++)
+    {
+        queue.enqueue(i);
+        if (queue.getQueueLength() > QueueCapacity / 2)
+            sum += queue.dequeue();
+    }
+    queue.clear();
+    return sum;
+}
+
+
+/**
+ * @brief Sum all list elements by index with virtual calls.
+ */
+__attribute__((noinline)) long long sumVirtual(IList<int>& list)
+{
+    long long sum = 0;
+    for (size_t i = 0; i < list.size(); i++)
+        sum += list.get(i);
+    return sum;
+}
+
+
+/**
+ * @brief The same through the static interface.
+ */
+template <class List>
+__attribute__((noinline)) long long sumStatic(ListInterface<List, int>& list)
+{
+    long long sum = 0;
+    for (size_t i = 0; i < list.size(); i++)
+        sum += list.get(i);
+    return sum;
+}
+
+
+template <class Plain, class Virtual>
+void compareLists(const char* name, long long& checksum)
+{
+    Plain plain;
+    Virtual withVtable;
+    for (int i = 0; i < ListSize; i++)
+    {
+        plain.add(i);
+        withVtable.add(i);
+    }
+
+    double virtualTime = measure([&withVtable]() {
+        return sumVirtual(withVtable);
+    }, checksum, ListSize);
+    double staticTime = measure([&plain]() {
+        return sumStatic(plain);
+    }, checksum, ListSize);
+
+    cout << "ns per " << name << " get(), IList& (virtual): " << virtualTime
+        << ", ListInterface& (static): " << staticTime
+        << ", speedup: " << virtualTime / staticTime << "x" << endl;
+}
+
+
+int main()
+{
+    cout << "Object size (bytes), RingQueue<int, " << QueueCapacity << ">: " << sizeof(RingQueue<int, QueueCapacity>)
+        << ", StaticQueue<int, " << QueueCapacity << "> (with vtable pointer): " << sizeof(StaticQueue<int, QueueCapacity>) << endl;
+    cout << "Object size (bytes), RingQueue<char, 4>: " << sizeof(RingQueue<char, 4>)
+        << ", StaticQueue<char, 4>: " << sizeof(StaticQueue<char, 4>) << endl;
+    cout << "Object size (bytes), PlainGrowingArray<int>: " << sizeof(PlainGrowingArray<int>)
+        << ", GrowingArray<int>: " << sizeof(GrowingArray<int>) << endl;
+    cout << "Object size (bytes), PlainLinkedList<int>: " << sizeof(PlainLinkedList<int>)
+        << ", LinkedList<int>: " << sizeof(LinkedList<int>) << endl;
+
+    RingQueue<int, QueueCapacity> ringQueue;
+    StaticQueue<int, QueueCapacity> staticQueue;
+    long long checksum = 0;
+
+    double virtualTime = measure([&staticQueue]() {
+        return passThroughVirtual(staticQueue);
+    }, checksum);
+    double staticTime = measure([&ringQueue]() {
+        return passThroughStatic(ringQueue);
+    }, checksum);
+
+    cout << "ns per enqueue/dequeue, IQueue& (virtual): " << virtualTime
+        << ", QueueInterface& (static): " << staticTime
+        << ", speedup: " << virtualTime / staticTime << "x" << endl;
+
+    compareLists<PlainGrowingArray<int>, GrowingArray<int>>("GrowingArray", checksum);
+    compareLists<PlainLinkedList<int>, LinkedList<int>>("LinkedList", checksum);
+    cout << "(checksum " << checksum << ")" << endl;
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <iostream>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../StaticQueue.h"
+#include "../SpscQueue.h"
+#include "../MpmcQueue.h"
+
+using namespace std;
+using namespace SimpleDataStructures;
+
+
+static const int ItemsAmount = 2000000;
+static const size_t QueueSize = 1024;
+
+
+/**
+ * @brief StaticQueue protected by the mutex (how it has to be shared without lock-free queue).
+ */
+template <class T>
+class LockedStaticQueue
+{
+    StaticQueue<T> queue;
+    mutex queueMutex;
+
+public:
+    explicit LockedStaticQueue(size_t queueSize)
+        : queue(queueSize)
+    {
+    }
+
+    bool enqueue(const T& item)
+    {
+        lock_guard<mutex> lock(queueMutex);
+        return queue.enqueue(item);
+    }
+
+    bool tryDequeue(T& output)
+    {
+        lock_guard<mutex> lock(queueMutex);
+        if (queue.isEmpty())
+            return false;
+
+        output = queue.dequeue();
+        return true;
+    }
+};
+
+
+/**
+ * @brief Pass ItemsAmount integers from one producer thread to one consumer thread.
+ * @return Throughput in millions of items per second.
+ */
+template <class Queue>
+double measureProducerConsumer(Queue& queue)
+{
+    auto start = chrono::steady_clock::now();
+
+    thread producer([&queue]() {
+        for (int i = 0; i < ItemsAmount; i++)
+            while (!queue.enqueue(i))
+                this_thread::yield();
+    });
+
+    long long sum = 0;
+    int item;
+    for (int received = 0; received < ItemsAmount; )
+    {
+        if (queue.tryDequeue(item))
+        {
+            sum += item;
+            received++;
+        }
+        else
+            this_thread::yield();
+    }
+
+    producer.join();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    if (sum != (long long)ItemsAmount * (ItemsAmount - 1) / 2)
+        cout << "ERROR: wrong sum of received items" << endl;
+
+    return ItemsAmount / elapsed.count() / 1e6;
+}
+
+
+/**
+ * @brief Pass ItemsAmount integers from producersAmount threads to one consumer thread.
+ * @return Throughput in millions of items per second.
+ */
+template <class Queue>
+double measureFanIn(Queue& queue, int producersAmount)
+{
+    const int ItemsPerProducer = ItemsAmount / producersAmount;
+    auto start = chrono::steady_clock::now();
+
+    vector<thread> producers;
+    for (int p = 0; p < producersAmount; p++)
+        producers.emplace_back([&queue, ItemsPerProducer]() {
+            for (int i = 0; i < ItemsPerProducer; i++)
+                while (!queue.enqueue(i))
+                    this_thread::yield();
+        });
+
+    int item;
+    for (int received = 0; received < ItemsPerProducer * producersAmount; )
+    {
+        if (queue.tryDequeue(item))
+            received++;
+        else
+            this_thread::yield();
+    }
+
+    for (thread& producer : producers)
+        producer.join();
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return ItemsPerProducer * producersAmount / elapsed.count() / 1e6;
+}
+
+
+int main()
+{
+    cout << "Single producer, single consumer (" << ItemsAmount << " items, queue size "
+        << QueueSize << ", " << thread::hardware_concurrency() << " hardware threads)" << endl;
+
+    LockedStaticQueue<int> lockedQueue(QueueSize);
+    cout << "StaticQueue + mutex: " << measureProducerConsumer(lockedQueue) << " M items/s" << endl;
+
+    SpscQueue<int> spscQueue(QueueSize);
+    cout << "SpscQueue:           " << measureProducerConsumer(spscQueue) << " M items/s" << endl;
+
+    cout << endl << "Many producers, single consumer (M items/s)" << endl;
+    cout << "producers\tStaticQueue + mutex\tMpmcQueue" << endl;
+    for (int producers = 1; producers <= 16; producers *= 2)
+    {
+        LockedStaticQueue<int> lockedFanInQueue(QueueSize);
+        MpmcQueue<int> mpmcQueue(QueueSize);
+
+        cout << producers << "\t\t" << measureFanIn(lockedFanInQueue, producers)
+            << "\t\t\t" << measureFanIn(mpmcQueue, producers) << endl;
+    }
+
+    return 0;
+}
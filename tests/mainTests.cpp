@@ -1,8 +1,31 @@
 #include <iostream>
 #include <cstdlib>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
 #include "../LinkedList.h"
+#include "../DoublyLinkedList.h"
+#include "../UnrolledList.h"
 #include "../GrowingArray.h"
 #include "../ListIterator.h"
+#include "../ArrayIterator.h"
+#include "../StaticQueue.h"
+#include "../StaticSinkingQueue.h"
+#include "../GrowingQueue.h"
+#include "../PriorityQueue.h"
+#include "../StatisticalSinkingQueue.h"
+#include "../FirFilter.h"
+#include "../SpscQueue.h"
+#include "../MpmcQueue.h"
+#include "../SeqlockSinkingQueue.h"
+#include "../HashMap.h"
+#include "../SortedArray.h"
+#include "../FlatMap.h"
 
 using namespace std;
 using namespace SimpleDataStructures;
@@ -38,8 +61,56 @@ void showListUsingIterator(IList<T>& list)
 }
 
 
+/**
+ * @brief Counts living instances to check that only
+ * elements in the container are constructed.
+ */
+struct LifetimeCounter
+{
+    static int alive;
+    static int copies;
+    int value;
+
+    LifetimeCounter(int value = 0) : value(value) { alive++; }
+    LifetimeCounter(const LifetimeCounter& other) : value(other.value) { alive++; copies++; }
+    LifetimeCounter(LifetimeCounter&& other) noexcept : value(other.value) { alive++; }
+    LifetimeCounter& operator=(const LifetimeCounter& other) { value = other.value; copies++; return *this; }
+    LifetimeCounter& operator=(LifetimeCounter&& other) noexcept { value = other.value; return *this; }
+    ~LifetimeCounter() { alive--; }
+    bool operator==(const LifetimeCounter& other) const { return value == other.value; }
+};
+
+int LifetimeCounter::alive = 0;
+int LifetimeCounter::copies = 0;
+
+
+/**
+ * @brief Copy throws when copiesUntilThrow gets to zero (no move constructor,
+ * so containers have to copy). Destroyed instances are marked and living ones counted.
+ */
+struct ThrowingCopy
+{
+    static int copiesUntilThrow;
+    static int alive;
+    int value;
+    bool destroyed = false;
+
+    ThrowingCopy(int value = 0) : value(value) { alive++; }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value) { if (--copiesUntilThrow == 0) throw 1; alive++; }
+    ThrowingCopy& operator=(const ThrowingCopy& other) = default;
+    ~ThrowingCopy() { destroyed = true; alive--; }
+    bool operator==(const ThrowingCopy& other) const { return value == other.value; }
+};
+
+int ThrowingCopy::copiesUntilThrow = -1;
+int ThrowingCopy::alive = 0;
+
+
+
 template <class T>
 void performTests(string header);
+template <class Test>
+void performSingleTest(Test test, string testName);
 
 // Testing functions:
 template <class T>
@@ -54,6 +125,137 @@ template <class T>
 void iteratorTest();
 template <class T>
 void removingUsingIteratorTest();
+template <class T>
+void moveSemanticsTest();
+
+// GrowingArray specific:
+void growingArrayCapacityTest();
+void growingArrayStorageTest();
+template <class T>
+void simdFindTest();
+void growingArrayFindTest();
+template <class T>
+void growingArrayRemovalTest();
+
+// LinkedList specific:
+void nodeAllocatorsTest();
+void linkedListRemovingIteratorTest();
+
+// DoublyLinkedList specific:
+void doublyLinkedListTest();
+
+// UnrolledList specific:
+void unrolledListTest();
+
+// Static interfaces:
+template <class List>
+void staticListTest(ListInterface<List, int>& list);
+void staticListsTest();
+
+// Queues:
+template <class List>
+void staticListTest(ListInterface<List, int>& list)
+{
+    list.clear();
+    for (int i = 0; i < 10; i++)
+        list.add(i);
+    list.add(100, 5);
+    int toMove = 200;
+    list.add(std::move(toMove));
+
+    assertEquals<size_t>(12, list.size());
+    assertEquals(100, list[5]);
+    assertEquals(200, list.get(11));
+    assertEquals<size_t>(5, list.find(100));
+    assertEquals(true, list.contains(9));
+
+    list.replace(50, 0);
+    assertEquals(50, list[0]);
+    list.remove(5);
+    assertEquals(false, list.contains(100));
+    assertEquals(5, list[5]);
+    assertEquals<size_t>(11, list.size());
+
+    list.clear();
+    assertEquals(true, list.isEmpty());
+}
+
+
+void staticListsTest()
+{
+    static_assert(!std::is_polymorphic<PlainGrowingArray<int>>::value, "PlainGrowingArray shouldn't have a vtable");
+    static_assert(!std::is_polymorphic<PlainLinkedList<int>>::value, "PlainLinkedList shouldn't have a vtable");
+    static_assert(sizeof(PlainGrowingArray<int>) < sizeof(GrowingArray<int>), "vtable pointer is only in GrowingArray");
+    static_assert(sizeof(PlainLinkedList<int>) < sizeof(LinkedList<int>), "vtable pointer is only in LinkedList");
+
+    PlainGrowingArray<int> plainArray;
+    staticListTest(plainArray);
+    PlainLinkedList<int> plainList;
+    staticListTest(plainList);
+
+    ArrayInterface<PlainGrowingArray<int>, int>& arrayInterface = plainArray;
+    arrayInterface.add(7);
+    assertEquals(7, arrayInterface.toArray()[0]);
+    assertEquals(false, arrayInterface.isFull());
+
+    // classes with the virtual interface work with both
+    GrowingArray<int> array;
+    staticListTest(array);
+    LinkedList<int> list;
+    staticListTest(list);
+    IList<int>& listInterface = list;
+    listInterface.add(3);
+    assertEquals(3, list[0]);
+
+    // ListIterator works with the list that got the virtual interface from the adapter
+    VirtualListAdapter<PlainLinkedList<int>> adaptedList;
+    for (int i = 0; i < 6; i++)
+        adaptedList.add(i);
+    auto iter = ListIterator<int>(adaptedList);
+    while (iter.hasNext())
+        if (iter.next() % 2 == 1)
+            iter.remove();
+    assertEquals<size_t>(3, adaptedList.size());
+    assertEquals(4, adaptedList[2]);
+}
+
+
+
+template <class Queue>
+void staticQueueTest(Queue& queue, size_t capacity);
+void staticQueuesTest();
+template <class Queue>
+void bulkQueueTest(Queue& queue, size_t capacity);
+void bulkQueuesTest();
+template <class Queue>
+void randomAccessQueueTest(Queue& queue, size_t capacity);
+void randomAccessQueuesTest();
+void statisticalSinkingQueueTest();
+void staticSinkingQueueTest();
+void growingQueueTest();
+template <class Queue>
+void priorityQueueTest(Queue& queue, bool greatestFirst);
+void priorityQueuesTest();
+void spscQueueTest();
+void mpmcQueueTest();
+void seqlockSinkingQueueTest();
+
+// Filters:
+void firFilterTest();
+
+// STL compatibility:
+void stlIteratorsTest();
+void internalIterationTest();
+
+// Maps:
+template <class Map>
+void mapTest(Map& map, size_t elementsAmount);
+void hashMapTest();
+void staticHashMapTest();
+void flatMapTest();
+
+// SortedArray specific:
+void sortedArrayTest();
 
 
 
@@ -63,7 +265,68 @@ int main()
     cout << "Absolute value of that code is number of assertion in a test" << endl;
 
     performTests<LinkedList<int>>("Linked list tests");
+    performTests<LinkedList<int, PoolNodeAllocator<Node<int>>>>("Linked list (node pool) tests");
+    performTests<LinkedList<int, StaticNodePool<Node<int>, 128>>>("Linked list (static node pool) tests");
+    performTests<DoublyLinkedList<int>>("Doubly linked list tests");
+    performTests<DoublyLinkedList<int, PoolNodeAllocator<DoublyLinkedNode<int>>>>("Doubly linked list (node pool) tests");
+    performTests<UnrolledList<int>>("Unrolled list tests");
+    performTests<UnrolledList<int, 2>>("Unrolled list (block size 2) tests");
     performTests<GrowingArray<int>>("Growing array tests");
+    performTests<GrowingArray<int, ExactGrowth>>("Growing array (exact growth) tests");
+    performTests<GrowingArray<int, ChunkGrowth<8>>>("Growing array (chunk growth) tests");
+    performTests<GrowingArray<int, OneAndHalfGrowth>>("Growing array (1.5x growth) tests");
+
+    performSingleTest(moveSemanticsTest<LinkedList<LifetimeCounter>>, "linked list moveSemanticsTest");
+    performSingleTest(moveSemanticsTest<GrowingArray<LifetimeCounter>>, "growing array moveSemanticsTest");
+    performSingleTest(moveSemanticsTest<DoublyLinkedList<LifetimeCounter>>, "doubly linked list moveSemanticsTest");
+    performSingleTest(moveSemanticsTest<UnrolledList<LifetimeCounter, 2>>, "unrolled list moveSemanticsTest");
+
+    cout << endl << ">> Growing array specific tests:" << endl;
+    performSingleTest(growingArrayCapacityTest, "growingArrayCapacityTest");
+    performSingleTest(growingArrayStorageTest, "growingArrayStorageTest");
+    performSingleTest(growingArrayFindTest, "growingArrayFindTest");
+    performSingleTest(growingArrayRemovalTest<int>, "growingArrayRemovalTest<int>");
+    performSingleTest(growingArrayRemovalTest<LifetimeCounter>, "growingArrayRemovalTest<LifetimeCounter>");
+
+    cout << endl << ">> Linked list specific tests:" << endl;
+    performSingleTest(nodeAllocatorsTest, "nodeAllocatorsTest");
+    performSingleTest(linkedListRemovingIteratorTest, "linkedListRemovingIteratorTest");
+
+    cout << endl << ">> Doubly linked list specific tests:" << endl;
+    performSingleTest(doublyLinkedListTest, "doublyLinkedListTest");
+
+    cout << endl << ">> Unrolled list specific tests:" << endl;
+    performSingleTest(unrolledListTest, "unrolledListTest");
+
+    cout << endl << ">> Static interface tests:" << endl;
+    performSingleTest(staticListsTest, "staticListsTest");
+
+    cout << endl << ">> Sorted array specific tests:" << endl;
+    performSingleTest(sortedArrayTest, "sortedArrayTest");
+
+    cout << endl << ">> Queue tests:" << endl;
+    performSingleTest(staticQueuesTest, "staticQueuesTest");
+    performSingleTest(staticSinkingQueueTest, "staticSinkingQueueTest");
+    performSingleTest(growingQueueTest, "growingQueueTest");
+    performSingleTest(priorityQueuesTest, "priorityQueuesTest");
+    performSingleTest(bulkQueuesTest, "bulkQueuesTest");
+    performSingleTest(randomAccessQueuesTest, "randomAccessQueuesTest");
+    performSingleTest(statisticalSinkingQueueTest, "statisticalSinkingQueueTest");
+    performSingleTest(spscQueueTest, "spscQueueTest");
+    performSingleTest(mpmcQueueTest, "mpmcQueueTest");
+    performSingleTest(seqlockSinkingQueueTest, "seqlockSinkingQueueTest");
+
+    cout << endl << ">> Filter tests:" << endl;
+    performSingleTest(firFilterTest, "firFilterTest");
+
+    cout << endl << ">> STL compatibility tests:" << endl;
+    performSingleTest(stlIteratorsTest, "stlIteratorsTest");
+    performSingleTest(internalIterationTest, "internalIterationTest");
+
+    cout << endl << ">> Map tests:" << endl;
+    performSingleTest(hashMapTest, "hashMapTest");
+    performSingleTest(staticHashMapTest, "staticHashMapTest");
+    performSingleTest(flatMapTest, "flatMapTest");
 
     cout << endl << ">> SUCCESS, end of testing" << endl;
 
@@ -321,3 +584,1787 @@ void removingUsingIteratorTest()
     }
 }
 
+
+
+
+template <class T>
+void moveSemanticsTest()
+{
+    LifetimeCounter::copies = 0;
+
+    {
+        T testList;
+
+        LifetimeCounter sample(1);
+        testList.add(std::move(sample));
+        testList.add(LifetimeCounter(0), 0);
+        testList.emplace(3);
+        testList.emplaceAt(2, 2);
+        testList.replace(LifetimeCounter(33), 3);
+
+        assertEquals(0, LifetimeCounter::copies);
+        assertEquals<size_t>(4, testList.size());
+        assertEquals(0, testList[0].value);
+        assertEquals(1, testList[1].value);
+        assertEquals(2, testList[2].value);
+        assertEquals(33, testList[3].value);
+
+        assertEquals(false, testList.emplaceAt(10, 5));
+
+        testList.add(sample); // lvalue is still copied
+        assertEquals(1, LifetimeCounter::copies);
+    }
+
+    assertEquals(0, LifetimeCounter::alive);
+}
+
+
+void growingArrayCapacityTest()
+{
+    GrowingArray<int> doubling;
+    for (int i = 0; i < 5; i++)
+        doubling.add(i);
+    assertEquals<size_t>(8, doubling.capacity());
+    for (int i = 5; i < 9; i++)
+        doubling.add(i);
+    assertEquals<size_t>(16, doubling.capacity());
+
+    GrowingArray<int, ExactGrowth> exact;
+    for (int i = 0; i < 5; i++)
+        exact.add(i);
+    assertEquals<size_t>(5, exact.capacity());
+
+    GrowingArray<int, ChunkGrowth<8>> chunk;
+    for (int i = 0; i < 9; i++)
+        chunk.add(i);
+    assertEquals<size_t>(16, chunk.capacity());
+
+    GrowingArray<int, OneAndHalfGrowth> oneAndHalf;
+    for (int i = 0; i < 7; i++)
+        oneAndHalf.add(i);
+    assertEquals<size_t>(9, oneAndHalf.capacity());
+
+    GrowingArray<int> reserved;
+    reserved.reserve(100);
+    assertEquals<size_t>(100, reserved.capacity());
+    for (int i = 0; i < 100; i++)
+        reserved.add(i);
+    assertEquals<size_t>(100, reserved.capacity());
+    reserved.reserve(10); // never shrinks
+    assertEquals<size_t>(100, reserved.capacity());
+
+    for (int i = 0; i < 60; i++)
+        reserved.remove(0);
+    assertEquals<size_t>(100, reserved.capacity());
+    reserved.shrinkToFit();
+    assertEquals<size_t>(40, reserved.capacity());
+    assertEquals<size_t>(40, reserved.size());
+    assertEquals(60, reserved[0]);
+    assertEquals(99, reserved[39]);
+
+    reserved.clear();
+    reserved.shrinkToFit();
+    assertEquals<size_t>(0, reserved.capacity());
+    assertEquals(true, reserved.toArray() == nullptr);
+}
+
+
+
+void growingArrayStorageTest()
+{
+    {
+        GrowingArray<LifetimeCounter> array(50);
+        assertEquals(1, LifetimeCounter::alive); // only null item
+
+        for (int i = 0; i < 10; i++)
+            array.add(LifetimeCounter(i));
+        assertEquals(11, LifetimeCounter::alive);
+
+        LifetimeCounter::copies = 0;
+        array.reserve(1000); // growth moves elements
+        assertEquals(0, LifetimeCounter::copies);
+        assertEquals(11, LifetimeCounter::alive);
+
+        array.add(LifetimeCounter(100), 3);
+        array.remove(0);
+        assertEquals(11, LifetimeCounter::alive);
+        assertEquals(100, array[2].value);
+        assertEquals(9, array[9].value);
+
+        array.shrinkToFit();
+        assertEquals<size_t>(10, array.capacity());
+        array.add(array[0]); // element of the same array while reallocating
+        assertEquals(1, array[10].value);
+
+        GrowingArray<LifetimeCounter> copy(array);
+        assertEquals(24, LifetimeCounter::alive); // both arrays have their own null item
+        copy = array;
+        assertEquals(24, LifetimeCounter::alive);
+        copy.clear();
+        assertEquals(13, LifetimeCounter::alive);
+    }
+    assertEquals(0, LifetimeCounter::alive);
+
+    // copy throwing during reallocation leaves the array unchanged
+    GrowingArray<ThrowingCopy> throwing(4);
+    for (int i = 0; i < 4; i++)
+        throwing.emplace(i);
+    int aliveBefore = ThrowingCopy::alive;
+    ThrowingCopy::copiesUntilThrow = 3;
+    bool thrown = false;
+    try
+    {
+        throwing.emplace(4);
+    }
+    catch (int)
+    {
+        thrown = true;
+    }
+    ThrowingCopy::copiesUntilThrow = -1;
+    assertEquals(true, thrown);
+    assertEquals(aliveBefore, ThrowingCopy::alive); // copied elements and the new one are destroyed
+    assertEquals<size_t>(4, throwing.size());
+    assertEquals<size_t>(4, throwing.capacity());
+    for (int i = 0; i < 4; i++)
+    {
+        assertEquals(i, throwing[i].value);
+        assertEquals(false, throwing[i].destroyed);
+    }
+
+    GrowingArray<string> strings;
+    for (int i = 0; i < 20; i++)
+        strings.add(to_string(i), 0);
+    strings.remove(5);
+    assertEquals<string>("19", strings[0]);
+    assertEquals<string>("13", strings[5]);
+    assertEquals<string>("0", strings[18]);
+}
+
+
+
+template <class T>
+void growingArrayRemovalTest()
+{
+    LifetimeCounter::alive = 0;
+    {
+        GrowingArray<T> array;
+        for (int i = 0; i < 10; i++)
+            array.add(T(i));
+
+        // 0 1 2 3 4 5 6 7 8 9
+        assertEquals(true, array.removeUnordered(2));
+        assertEquals(true, array.removeUnordered(8)); // last one
+        assertEquals(false, array.removeUnordered(8));
+        assertEquals<size_t>(8, array.size());
+        assertEquals(true, array[2] == T(9));
+        assertEquals(true, array[7] == T(7));
+
+        // 0 1 9 3 4 5 6 7
+        assertEquals(true, array.removeRange(1, 4));
+        assertEquals(true, array.removeRange(2, 2));
+        assertEquals(false, array.removeRange(3, 2));
+        assertEquals(false, array.removeRange(2, 6));
+        assertEquals<size_t>(5, array.size());
+        assertEquals(true, array[0] == T(0));
+        assertEquals(true, array[1] == T(4));
+        assertEquals(true, array[4] == T(7));
+
+        // 0 4 5 6 7 -> 0 4 5 6 7 0 4 5 6 7
+        for (int i = 0; i < 5; i++)
+            array.add(T(array[i]));
+        assertEquals<size_t>(2, array.removeAll(T(5)));
+        assertEquals<size_t>(2, array.removeAll(array[0])); // element of this array
+        assertEquals<size_t>(0, array.removeAll(T(100)));
+        // 4 6 7 4 6 7
+        assertEquals<size_t>(2, array.removeIf([](const T& element) { return element == T(7); }));
+        assertEquals<size_t>(4, array.size());
+        assertEquals(true, array[0] == T(4));
+        assertEquals(true, array[1] == T(6));
+        assertEquals(true, array[2] == T(4));
+
+        assertEquals(true, array.removeRange(0, array.size()));
+        assertEquals(true, array.isEmpty());
+    }
+    if (std::is_same<T, LifetimeCounter>::value)
+        assertEquals(0, LifetimeCounter::alive);
+}
+
+
+void nodeAllocatorsTest()
+{
+    LinkedList<int, PoolNodeAllocator<Node<int>, 8>> pooledList;
+    pooledList.getNodeAllocator().preallocate(20, true);
+    assertEquals<size_t>(24, pooledList.getNodeAllocator().capacity());
+
+    for (int i = 0; i < 24; i++)
+        assertEquals(true, pooledList.add(i));
+    assertEquals(false, pooledList.add(24)); // fixed capacity
+    assertEquals(false, pooledList.add(24, 3));
+    assertEquals<size_t>(24, pooledList.size());
+
+    // removed nodes are recycled
+    for (int i = 0; i < 1000; i++)
+    {
+        pooledList.remove(0);
+        assertEquals(true, pooledList.add(i));
+    }
+    pooledList.clear();
+    for (int i = 0; i < 24; i++)
+        assertEquals(true, pooledList.add(i));
+    assertEquals<size_t>(24, pooledList.getNodeAllocator().capacity());
+
+    // moving takes the pool together with nodes
+    LinkedList<int, PoolNodeAllocator<Node<int>, 8>> movedPooledList(std::move(pooledList));
+    assertEquals<size_t>(24, movedPooledList.size());
+    assertEquals<size_t>(24, movedPooledList.getNodeAllocator().capacity());
+    assertEquals(23, movedPooledList[23]);
+    assertEquals(true, pooledList.isEmpty());
+    assertEquals(true, pooledList.add(5));
+
+
+    LinkedList<int, StaticNodePool<Node<int>, 4>> staticList;
+    for (int i = 0; i < 4; i++)
+        assertEquals(true, staticList.add(i));
+    assertEquals(false, staticList.add(4));
+
+    // copy has its own pool (of the same capacity, so all elements fit)
+    LinkedList<int, StaticNodePool<Node<int>, 4>> staticCopy;
+    staticCopy = staticList;
+    assertEquals<size_t>(4, staticCopy.size());
+    assertEquals(3, staticCopy[3]);
+    assertEquals(false, staticCopy.add(4));
+    staticCopy.remove(0);
+    assertEquals<size_t>(4, staticList.size());
+
+    LinkedList<int, StaticNodePool<Node<int>, 4>> movedStaticList(std::move(staticList));
+    assertEquals<size_t>(4, movedStaticList.size());
+    assertEquals(true, staticList.isEmpty());
+    assertEquals(3, movedStaticList[3]);
+
+    auto iter = LinkedListIterator<int>(movedStaticList);
+    iter.reset();
+    iter.reset(movedStaticList);
+    for (int i = 0; i < 4; i++)
+        assertEquals(i, iter.next());
+    assertEquals(false, iter.hasNext());
+}
+
+
+
+void linkedListRemovingIteratorTest()
+{
+    LinkedList<int> list;
+    for (int i = 0; i < 10; i++)
+        list.add(i);
+
+    // remove first, consecutive, and last elements
+    LinkedListRemovingIterator<int> iter(list);
+    assertEquals(false, iter.remove()); // before next()
+    while (iter.hasNext())
+    {
+        int item = iter.next();
+        if (item == 0 || item == 4 || item == 5 || item == 9)
+            assertEquals(true, iter.remove());
+    }
+    assertEquals(false, iter.remove()); // already removed
+    assertEquals<size_t>(6, list.size());
+    int expected[] = { 1, 2, 3, 6, 7, 8 };
+    for (size_t i = 0; i < 6; i++)
+        assertEquals(expected[i], list[i]);
+
+    // tail has to be updated
+    list.add(100);
+    assertEquals(100, list[6]);
+    assertEquals<size_t>(7, list.size());
+
+    // remove everything
+    iter.reset(list);
+    while (iter.hasNext())
+    {
+        iter.next();
+        iter.remove();
+    }
+    assertEquals(true, list.isEmpty());
+    list.add(1);
+    assertEquals(1, list[0]);
+
+    // filter a long list (would be O(n^2) with ListIterator)
+    LinkedList<int, PoolNodeAllocator<Node<int>>> longList;
+    for (int i = 0; i < 100000; i++)
+        longList.add(i);
+    LinkedListRemovingIterator<int, PoolNodeAllocator<Node<int>>> longIter(longList);
+    while (longIter.hasNext())
+        if (longIter.next() % 3 != 0)
+            longIter.remove();
+    assertEquals<size_t>(33334, longList.size());
+    assertEquals(99999, longList[33333]);
+
+    RemovingIterator<int>& iterInterface = longIter;
+    longIter.reset(longList);
+    iterInterface.next();
+    iterInterface.remove();
+    assertEquals(3, longList[0]);
+
+    LinkedListRemovingIterator<int, PoolNodeAllocator<Node<int>>> movedIter(std::move(longIter));
+    assertEquals(true, movedIter.hasNext());
+    assertEquals(false, longIter.hasNext());
+    assertEquals(3, movedIter.next());
+}
+
+
+void doublyLinkedListTest()
+{
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < 10; i++)
+        list.add(i);
+
+    // backward access by index
+    for (int i = 9; i >= 0; i--)
+        assertEquals(i, list[i]);
+
+    list.remove(9);
+    list.remove(0);
+    assertEquals<size_t>(8, list.size());
+    assertEquals(1, list[0]);
+    assertEquals(8, list[7]);
+
+    // remove through iterator
+    auto iter = DoublyLinkedListIterator<int>(list);
+    while (iter.hasNext())
+        if (iter.next() % 2 == 0)
+            assertEquals(true, iter.remove());
+    assertEquals(false, iter.remove());
+    assertEquals<size_t>(4, list.size());
+    assertEquals(1, list[0]);
+    assertEquals(7, list[3]);
+    list.add(100);
+    assertEquals(100, list[4]);
+
+    // random operations compared with std::vector (checks the cached node)
+    vector<int> reference;
+    list.clear();
+    srand(1234);
+    for (int i = 0; i < 3000; i++)
+    {
+        size_t index = reference.empty() ? 0 : rand() % (reference.size() + 1);
+        switch (rand() % 4)
+        {
+        case 0:
+            list.add(i, index);
+            reference.insert(reference.begin() + index, i);
+            break;
+        case 1:
+            if (index < reference.size())
+            {
+                list.remove(index);
+                reference.erase(reference.begin() + index);
+            }
+            break;
+        default:
+            if (index < reference.size())
+                assertEquals(reference[index], list[index]);
+        }
+        assertEquals(reference.size(), list.size());
+    }
+
+    for (size_t i = 0; i < reference.size(); i++)
+        assertEquals(reference[i], list.get(i));
+}
+
+
+
+void unrolledListTest()
+{
+    UnrolledList<int, 8> list;
+    for (int i = 0; i < 64; i++)
+        list.add(i);
+    assertEquals<size_t>(8, list.getBlocksAmount());
+
+    // inserting into a full block split it
+    list.add(1000, 3);
+    assertEquals<size_t>(9, list.getBlocksAmount());
+    assertEquals(1000, list[3]);
+    assertEquals(3, list[4]);
+    assertEquals(63, list[64]);
+
+    // removing merges blocks that are less than half full
+    for (int i = 0; i < 6; i++)
+        list.remove(0);
+    assertEquals<size_t>(8, list.getBlocksAmount());
+    assertEquals(5, list[0]);
+
+    auto iter = UnrolledListIterator<int, 8>(list);
+    int expected = 5;
+    while (iter.hasNext())
+        assertEquals(expected++, iter.next());
+    assertEquals(64, expected);
+
+    UnrolledList<int, 8> twoBlocks;
+    for (int i = 0; i < 16; i++)
+        twoBlocks.add(i);
+    for (int i = 0; i < 3; i++)
+        twoBlocks.remove(8);
+    for (int i = 0; i < 5; i++)
+        twoBlocks.remove(0);
+    assertEquals<size_t>(1, twoBlocks.getBlocksAmount()); // [5, 6, 7] merged with [11..15]
+    assertEquals<size_t>(8, twoBlocks.size());
+    assertEquals(5, twoBlocks[0]);
+    assertEquals(11, twoBlocks[3]);
+    assertEquals(15, twoBlocks[7]);
+
+    // block that can't be merged borrows elements from a neighbour
+    UnrolledList<int, 8> threeBlocks;
+    for (int i = 0; i < 24; i++)
+        threeBlocks.add(i);
+    for (int i = 0; i < 5; i++)
+        threeBlocks.remove(8); // [0..7] [13, 14, 15] [16..23]
+    assertEquals<size_t>(3, threeBlocks.getBlocksAmount());
+    assertEquals<size_t>(8, threeBlocks.getBlockLength(0));
+    assertEquals<size_t>(5, threeBlocks.getBlockLength(1));
+    assertEquals<size_t>(6, threeBlocks.getBlockLength(2));
+    for (int i = 0; i < 8; i++)
+        assertEquals(i, threeBlocks[i]);
+    for (int i = 8; i < 19; i++)
+        assertEquals(i + 5, threeBlocks[i]);
+
+    // under half full last block is merged with the previous one
+    for (int i = 0; i < 3; i++)
+        threeBlocks.remove(threeBlocks.size() - 1); // [0..7] [13..17] [18, 19, 20]
+    assertEquals<size_t>(2, threeBlocks.getBlocksAmount());
+    assertEquals<size_t>(8, threeBlocks.getBlockLength(1));
+    assertEquals(20, threeBlocks[15]);
+
+    // after many removals every block is at least half full
+    UnrolledList<int, 8> sparse;
+    vector<int> sparseReference;
+    for (int i = 0; i < 1000; i++)
+    {
+        sparse.add(i);
+        sparseReference.push_back(i);
+    }
+    srand(1234);
+    bool halfFull = true;
+    while (sparse.size() > 10)
+    {
+        size_t index = rand() % sparse.size();
+        sparse.remove(index);
+        sparseReference.erase(sparseReference.begin() + index);
+        for (size_t block = 0; block < sparse.getBlocksAmount(); block++)
+            halfFull = halfFull && sparse.getBlockLength(block) >= 4;
+    }
+    assertEquals(true, halfFull);
+    for (size_t i = 0; i < sparseReference.size(); i++)
+        assertEquals(sparseReference[i], sparse[i]);
+
+    // random operations compared with std::vector
+    UnrolledList<LifetimeCounter, 4> counters;
+    vector<int> reference;
+    srand(4321);
+    for (int i = 0; i < 3000; i++)
+    {
+        size_t index = reference.empty() ? 0 : rand() % (reference.size() + 1);
+        switch (rand() % 4)
+        {
+        case 0:
+        case 1:
+            counters.add(LifetimeCounter(i), index);
+            reference.insert(reference.begin() + index, i);
+            break;
+        case 2:
+            if (index < reference.size())
+            {
+                counters.remove(index);
+                reference.erase(reference.begin() + index);
+            }
+            break;
+        default:
+            if (index < reference.size())
+                assertEquals(reference[index], counters[index].value);
+        }
+    }
+
+    assertEquals(reference.size(), counters.size());
+    for (size_t i = 0; i < reference.size(); i++)
+        assertEquals(reference[i], counters.get(i).value);
+    assertEquals((int)reference.size() + 1, LifetimeCounter::alive);
+
+    counters.clear();
+    assertEquals(1, LifetimeCounter::alive);
+}
+
+
+
+template <class T>
+void simdFindTest()
+{
+    // every length up to several vectors and every position of the searched element
+    const size_t MaxLength = 80;
+    T array[MaxLength] = {};
+    for (size_t length = 0; length <= MaxLength; length++)
+    {
+        for (size_t i = 0; i < length; i++)
+            array[i] = (T)(i % 50 + 1);
+
+        assertEquals(length, SimdKernels::find(array, length, (T)0));
+
+        for (size_t position = 0; position < length; position++)
+        {
+            T saved = array[position];
+            array[position] = (T)0;
+            assertEquals(position, SimdKernels::find(array, length, (T)0));
+            array[position] = saved;
+        }
+    }
+}
+
+
+void growingArrayFindTest()
+{
+    simdFindTest<uint8_t>();
+    simdFindTest<int16_t>();
+    simdFindTest<uint16_t>();
+    simdFindTest<int>();
+    simdFindTest<int64_t>();
+    simdFindTest<float>();
+    simdFindTest<double>();
+    simdFindTest<char>();
+
+    // the same value in other element half (64 bit compare can't match only one half)
+    int64_t halves[] = { 0x100000000ll, 1, 0x100000001ll };
+    assertEquals<size_t>(2, SimdKernels::find(halves, 3, (int64_t)0x100000001ll));
+    assertEquals<size_t>(3, SimdKernels::find(halves, 3, (int64_t)0x1ll << 33));
+
+    float floats[40] = {};
+    floats[35] = -0.0f;
+    assertEquals<size_t>(0, SimdKernels::find(floats, 40, -0.0f)); // 0 == -0, like operator==
+    floats[0] = NAN;
+    assertEquals<size_t>(40, SimdKernels::find(floats, 40, (float)NAN));
+
+    GrowingArray<uint16_t> channels;
+    for (uint16_t i = 0; i < 100; i++)
+        channels.add(i % 40);
+    assertEquals<size_t>(7, channels.find(7));
+    assertEquals<size_t>(47, channels.find(7, 8));
+    assertEquals<size_t>(87, channels.find(7, 87));
+    assertEquals(npos, channels.find(7, 88));
+    assertEquals(npos, channels.find(7, 1000));
+    assertEquals(npos, channels.find(40));
+    assertEquals(true, channels.contains(39));
+
+    ArrayIterator<uint16_t> iterator(channels);
+    assertEquals(true, iterator.advanceTo(39));
+    assertEquals<uint16_t>(39, iterator.next());
+    assertEquals<uint16_t>(0, iterator.next());
+    assertEquals(true, iterator.advanceTo(39));
+    assertEquals(true, iterator.advanceTo(39)); // already there
+    iterator.next();
+    assertEquals(false, iterator.advanceTo(39)); // 79 was the last one
+    assertEquals(false, iterator.hasNext());
+
+    GrowingArray<string> strings;
+    strings.add("a");
+    strings.add("b");
+    assertEquals<size_t>(1, strings.find("b"));
+}
+
+
+template <class Queue>
+void staticQueueTest(Queue& queue, size_t capacity)
+{
+    assertEquals(true, queue.isEmpty());
+    assertEquals<size_t>(0, queue.getQueueLength());
+
+    for (size_t i = 0; i < capacity; i++)
+        assertEquals(true, queue.enqueue((int)i));
+    assertEquals(true, queue.isFull());
+    assertEquals(false, queue.enqueue(-1));
+    assertEquals(0, queue.peek());
+
+    // go around the array several times
+    int nextExpected = 0;
+    int nextToEnqueue = (int)capacity;
+    for (size_t i = 0; i < capacity * 3 + 1; i++)
+    {
+        assertEquals(nextExpected++, queue.dequeue());
+        assertEquals(true, queue.enqueue(nextToEnqueue++));
+    }
+
+    while (!queue.isEmpty())
+        assertEquals(nextExpected++, queue.dequeue());
+    assertEquals(nextToEnqueue, nextExpected);
+
+    queue.enqueue(5);
+    queue.clear();
+    assertEquals(true, queue.isEmpty());
+}
+
+
+void staticQueuesTest()
+{
+    StaticQueue<int> runtimeSizeQueue(5);
+    staticQueueTest(runtimeSizeQueue, 5);
+
+    StaticQueue<int, 5> compileTimeSizeQueue;
+    staticQueueTest(compileTimeSizeQueue, 5);
+
+    StaticQueue<int, 8> powerOfTwoSizeQueue;
+    staticQueueTest(powerOfTwoSizeQueue, 8);
+    assertEquals<size_t>(8, powerOfTwoSizeQueue.getCapacity());
+
+    IQueue<int>& queueInterface = powerOfTwoSizeQueue;
+    staticQueueTest(queueInterface, 8);
+
+    struct WithQueue
+    {
+        StaticQueue<int, 4> queue;
+    };
+    WithQueue withQueue;
+    withQueue.queue.enqueue(3);
+    WithQueue copied = withQueue;
+    assertEquals(3, copied.queue.dequeue());
+    assertEquals<size_t>(1, withQueue.queue.getQueueLength());
+
+    // queue without virtual methods, used through the static interface
+    static_assert(IsQueue<RingQueue<int, 8>>::value, "RingQueue should have all queue methods");
+    static_assert(IsQueue<IQueue<int>>::value, "IQueue should have all queue methods");
+    static_assert(!IsQueue<GrowingArray<int>>::value, "GrowingArray is not a queue");
+    static_assert(!std::is_polymorphic<RingQueue<int, 8>>::value, "RingQueue shouldn't have a vtable");
+    static_assert(sizeof(RingQueue<int, 8>) < sizeof(StaticQueue<int, 8>), "vtable pointer is only in StaticQueue");
+    RingQueue<int, 8> ringQueue;
+    staticQueueTest(ringQueue, 8);
+    QueueInterface<RingQueue<int, 8>, int>& staticInterface = ringQueue;
+    staticQueueTest(staticInterface, 8);
+    ringQueue.enqueue(1);
+    assertEquals(1, staticInterface.derived().peek(0));
+    constexpr RingQueue<int, 4> constexprQueue;
+    static_assert(constexprQueue.getCapacity() == 4, "RingQueue should be usable at compile time");
+    static_assert(constexprQueue.isEmpty() && !constexprQueue.isFull(), "RingQueue should be usable at compile time");
+    static_assert(constexprQueue.getQueueLength() == 0, "RingQueue should be usable at compile time");
+
+    // virtual interface added to the static queue
+    VirtualQueueAdapter<RingQueue<int, 5>> adaptedQueue;
+    IRandomAccessQueue<int>& adaptedInterface = adaptedQueue;
+    staticQueueTest(adaptedInterface, 5);
+    adaptedInterface.enqueue(1);
+    adaptedInterface.enqueue(2);
+    assertEquals(2, adaptedInterface.dequeue(1));
+    assertEquals<size_t>(1, adaptedQueue.getQueueLength());
+}
+
+
+
+template <class Queue>
+void bulkQueueTest(Queue& queue, size_t capacity)
+{
+    int input[20];
+    int output[20];
+    for (int i = 0; i < 20; i++)
+        input[i] = i;
+
+    // move the front, so that data is wrapped around the array end
+    queue.enqueue(-1);
+    queue.enqueue(-1);
+    assertEquals<size_t>(2, queue.dequeueBulk(output, 2));
+
+    assertEquals(capacity, queue.enqueueBulk(input, 20));
+    assertEquals(true, queue.isFull());
+    assertEquals<size_t>(0, queue.enqueueBulk(input, 1));
+
+    Span<int> contiguous = queue.peekContiguous();
+    assertEquals(capacity - 2, contiguous.size());
+    assertEquals(0, contiguous[0]);
+    assertEquals<size_t>(3, queue.discard(3));
+    assertEquals(3, queue.peek());
+
+    assertEquals<size_t>(3, queue.dequeueBulk(output, 3));
+    for (int i = 0; i < 3; i++)
+        assertEquals(i + 3, output[i]);
+
+    // write directly into the queue
+    Span<int> reserved = queue.reserveContiguous();
+    assertEquals(false, reserved.isEmpty());
+    for (size_t i = 0; i < reserved.size(); i++)
+        reserved[i] = 100 + (int)i;
+    assertEquals(reserved.size(), queue.commit(reserved.size() + 1)); // not more than reserved
+
+    size_t length = queue.getQueueLength();
+    assertEquals(length, queue.dequeueBulk(output, 20));
+    assertEquals(6, output[0]);
+    assertEquals(100, output[capacity - 6]);
+    assertEquals(true, queue.isEmpty());
+    assertEquals(true, queue.peekContiguous().isEmpty());
+    assertEquals<size_t>(0, queue.dequeueBulk(output, 20));
+}
+
+
+void bulkQueuesTest()
+{
+    StaticQueue<int> runtimeSizeQueue(7);
+    bulkQueueTest(runtimeSizeQueue, 7);
+
+    StaticQueue<int, 7> compileTimeSizeQueue;
+    bulkQueueTest(compileTimeSizeQueue, 7);
+
+    StaticQueue<int, 8> powerOfTwoSizeQueue;
+    bulkQueueTest(powerOfTwoSizeQueue, 8);
+
+    StaticQueue<string> stringQueue(3);
+    string strings[] = { "a", "b", "c", "d" };
+    stringQueue.enqueue("x");
+    stringQueue.dequeue();
+    assertEquals<size_t>(3, stringQueue.enqueueBulk(strings, 4));
+    string stringsOutput[3];
+    assertEquals<size_t>(3, stringQueue.dequeueBulk(stringsOutput, 3));
+    assertEquals<string>("c", stringsOutput[2]);
+
+    StaticSinkingQueue<int> sinkingQueue(5);
+    int input[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    sinkingQueue.enqueueBulk(input, 3);
+    sinkingQueue.enqueueBulk(input + 3, 4); // overwrites 1 and 2
+    assertEquals<size_t>(5, sinkingQueue.getQueueLength());
+    assertEquals(3, sinkingQueue.peek());
+    assertEquals<size_t>(8, sinkingQueue.enqueueBulk(input, 8)); // only last 5 are kept
+    for (int i = 4; i <= 8; i++)
+        assertEquals(i, sinkingQueue.dequeue());
+}
+
+
+template <class Queue>
+void randomAccessQueueTest(Queue& queue, size_t capacity)
+{
+    // data wrapped around the array end
+    for (size_t i = 0; i < capacity - 1; i++)
+        queue.enqueue(-1);
+    for (size_t i = 0; i < capacity - 1; i++)
+        queue.dequeue();
+    for (size_t i = 0; i < capacity; i++)
+        queue.enqueue((int)i);
+
+    for (size_t i = 0; i < capacity; i++)
+        assertEquals((int)i, queue.peek(i));
+
+    auto spans = queue.getSpans();
+    assertEquals<size_t>(1, spans.first.size());
+    assertEquals(capacity - 1, spans.second.size());
+    for (size_t i = 0; i < capacity; i++)
+        assertEquals((int)i, spans[i]);
+
+    // remove from the middle, from the end and from the front
+    assertEquals(2, queue.dequeue(2));
+    assertEquals((int)capacity - 1, queue.dequeue(capacity - 2));
+    assertEquals(0, queue.dequeue(0));
+    assertEquals(capacity - 3, queue.getQueueLength());
+    assertEquals(1, queue.dequeue());
+    for (size_t i = 3; i < capacity - 1; i++)
+        assertEquals((int)i, queue.dequeue());
+    assertEquals(true, queue.isEmpty());
+    assertEquals(true, queue.getSpans().isEmpty());
+}
+
+
+void randomAccessQueuesTest()
+{
+    StaticQueue<int> runtimeSizeQueue(6);
+    randomAccessQueueTest(runtimeSizeQueue, 6);
+
+    StaticQueue<int, 6> compileTimeSizeQueue;
+    randomAccessQueueTest(compileTimeSizeQueue, 6);
+
+    StaticSinkingQueue<int> sinkingQueue(8);
+    randomAccessQueueTest(sinkingQueue, 8);
+
+    IRandomAccessQueue<int>& queueInterface = runtimeSizeQueue;
+    queueInterface.enqueue(4);
+    queueInterface.enqueue(5);
+    assertEquals(5, queueInterface.peek(1));
+    assertEquals(4, queueInterface.peek());
+    assertEquals(5, queueInterface.dequeue(1));
+    assertEquals<size_t>(1, queueInterface.getQueueLength());
+
+    const StaticQueue<int>& constQueue = runtimeSizeQueue;
+    assertEquals(4, constQueue.peek(0));
+    assertEquals<size_t>(1, constQueue.getSpans().size());
+}
+
+
+void staticSinkingQueueTest()
+{
+    StaticSinkingQueue<int> queue(5);
+
+    for (int i = 0; i < 5; i++)
+        queue.enqueue(i);
+    assertEquals(0, queue.peek());
+
+    // overwrite the oldest elements
+    queue.enqueue(5);
+    queue.enqueue(6);
+    assertEquals<size_t>(5, queue.getQueueLength());
+    for (int i = 2; i < 7; i++)
+        assertEquals(i, queue.dequeue());
+    assertEquals(true, queue.isEmpty());
+}
+
+
+
+
+void growingQueueTest()
+{
+    GrowingQueue<int> limitedQueue(2, 5);
+    staticQueueTest(limitedQueue, 5);
+    assertEquals<size_t>(5, limitedQueue.getCapacity());
+
+    // grow while elements are wrapped around the array end
+    GrowingQueue<int> queue(4);
+    queue.enqueue(-1);
+    queue.enqueue(-1);
+    queue.dequeue();
+    queue.dequeue();
+    for (int i = 0; i < 100; i++)
+        assertEquals(true, queue.enqueue(i));
+    assertEquals(false, queue.isFull());
+    assertEquals<size_t>(100, queue.getQueueLength());
+    assertEquals<size_t>(128, queue.getCapacity());
+    for (int i = 0; i < 100; i++)
+        assertEquals(i, queue.peek((size_t)i));
+
+    // both ends
+    queue.enqueueFront(-5);
+    assertEquals(-5, queue.peek());
+    assertEquals(99, queue.peekBack());
+    assertEquals(99, queue.dequeueBack());
+    assertEquals(-5, queue.dequeue());
+    assertEquals(10, queue.dequeue(10));
+    assertEquals(90, queue.dequeue(89));
+    assertEquals(11, queue.peek(10));
+    assertEquals(91, queue.peek(89));
+    assertEquals<size_t>(97, queue.getQueueLength());
+
+    // shrink on drain (not below the initial capacity)
+    queue.setShrinkOnDrain(true);
+    while (queue.getQueueLength() > 10)
+        queue.dequeue();
+    assertEquals<size_t>(32, queue.getCapacity());
+    assertEquals(88, queue.peek());
+    queue.clear();
+    assertEquals<size_t>(4, queue.getCapacity());
+    assertEquals(true, queue.isEmpty());
+
+    // deque used as a stack from the front
+    GrowingQueue<int> stack;
+    for (int i = 0; i < 10; i++)
+        stack.enqueueFront(i);
+    for (int i = 9; i >= 0; i--)
+        assertEquals(i, stack.dequeue());
+
+    // elements are constructed only in used slots and destroyed properly
+    LifetimeCounter::alive = 0;
+    {
+        GrowingQueue<LifetimeCounter> counters;
+        int alive = LifetimeCounter::alive; // null and last dequeued item
+        for (int i = 0; i < 20; i++)
+            counters.emplaceBack(i);
+        counters.enqueueFront(LifetimeCounter(-1));
+        assertEquals(alive + 21, LifetimeCounter::alive);
+        counters.dequeue(5);
+        counters.dequeueBack();
+        assertEquals(alive + 19, LifetimeCounter::alive);
+
+        GrowingQueue<LifetimeCounter> copied = counters;
+        assertEquals(alive * 2 + 38, LifetimeCounter::alive);
+        GrowingQueue<LifetimeCounter> moved = std::move(copied);
+        assertEquals(-1, moved.peek().value);
+        assertEquals(18, moved.peekBack().value);
+        assertEquals(true, copied.isEmpty());
+    }
+    assertEquals(0, LifetimeCounter::alive);
+
+    GrowingQueue<string> strings(1);
+    strings.enqueue("a");
+    strings.enqueue(string("b"));
+    strings.enqueueFront("c");
+    GrowingQueue<string> stringsCopy;
+    stringsCopy = strings;
+    assertEquals<string>("c", stringsCopy.dequeue());
+    assertEquals<string>("a", stringsCopy.dequeue());
+    assertEquals<string>("b", stringsCopy.dequeue());
+    assertEquals<size_t>(3, strings.getQueueLength());
+
+    // enqueue own element while the queue grows (item references the old array)
+    GrowingQueue<string> aliasing(2);
+    aliasing.enqueue("first");
+    aliasing.enqueue("last");
+    aliasing.enqueue(aliasing.peek());
+    aliasing.enqueueFront(aliasing.peekBack());
+    assertEquals<size_t>(4, aliasing.getQueueLength());
+    assertEquals<size_t>(4, aliasing.getCapacity());
+    aliasing.enqueueFront(aliasing.peek(2));
+    assertEquals<string>("last", aliasing.dequeue());
+    assertEquals<string>("first", aliasing.dequeue());
+    assertEquals<string>("first", aliasing.dequeue());
+    assertEquals<string>("last", aliasing.dequeue());
+    assertEquals<string>("first", aliasing.dequeue());
+
+    // copy throwing during growth leaves the queue unchanged (both ends, wrapped elements)
+    GrowingQueue<ThrowingCopy> throwing(4);
+    throwing.emplaceBack(-1);
+    throwing.emplaceBack(-1);
+    throwing.dequeue();
+    throwing.dequeue();
+    for (int i = 0; i < 4; i++)
+        throwing.emplaceBack(i);
+    int aliveBefore = ThrowingCopy::alive;
+    for (int front = 0; front < 2; front++)
+    {
+        ThrowingCopy::copiesUntilThrow = 3;
+        bool thrown = false;
+        try
+        {
+            if (front)
+                throwing.emplaceFront(4);
+            else
+                throwing.emplaceBack(4);
+        }
+        catch (int)
+        {
+            thrown = true;
+        }
+        ThrowingCopy::copiesUntilThrow = -1;
+        assertEquals(true, thrown);
+        assertEquals(aliveBefore, ThrowingCopy::alive);
+        assertEquals<size_t>(4, throwing.getQueueLength());
+        assertEquals<size_t>(4, throwing.getCapacity());
+        for (int i = 0; i < 4; i++)
+        {
+            assertEquals(i, throwing.peek((size_t)i).value);
+            assertEquals(false, throwing.peek((size_t)i).destroyed);
+        }
+    }
+
+    IQueue<int>& queueInterface = stack;
+    assertEquals(true, queueInterface.enqueue(7));
+    assertEquals(7, queueInterface.dequeue());
+}
+
+
+template <class Queue>
+void priorityQueueTest(Queue& queue, bool greatestFirst)
+{
+    assertEquals(true, queue.isEmpty());
+
+    vector<int> expected;
+    srand(42);
+    for (int i = 0; i < 500; i++)
+    {
+        int item = rand() % 100; // with duplicates
+        expected.push_back(item);
+        assertEquals(true, queue.enqueue(item));
+
+        // dequeue some elements in between
+        if (i % 7 == 0)
+        {
+            auto best = greatestFirst ? max_element(expected.begin(), expected.end()) : min_element(expected.begin(), expected.end());
+            assertEquals(*best, queue.peek());
+            assertEquals(*best, queue.dequeue());
+            expected.erase(best);
+        }
+    }
+
+    assertEquals(expected.size(), queue.getQueueLength());
+    sort(expected.begin(), expected.end());
+    if (greatestFirst)
+        reverse(expected.begin(), expected.end());
+    for (int item : expected)
+        assertEquals(item, queue.dequeue());
+    assertEquals(true, queue.isEmpty());
+
+    queue.enqueue(3);
+    queue.clear();
+    assertEquals<size_t>(0, queue.getQueueLength());
+}
+
+
+void priorityQueuesTest()
+{
+    PriorityQueue<int> binaryHeap;
+    priorityQueueTest(binaryHeap, true);
+
+    PriorityQueue<int, std::less<int>, 4> fourAryHeap;
+    priorityQueueTest(fourAryHeap, true);
+
+    PriorityQueue<int, std::greater<int>, 3> minHeap;
+    priorityQueueTest(minHeap, false);
+
+    IQueue<int>& queueInterface = binaryHeap;
+    priorityQueueTest(queueInterface, true);
+
+    // built from the array (heapify)
+    int items[] = { 5, 1, 9, 3, 7, 9, 2, 8, 6, 4 };
+    PriorityQueue<int, std::less<int>, 4> built(items, 10);
+    assertEquals<size_t>(10, built.getQueueLength());
+    int moreItems[] = { 10, 0, 11 };
+    built.enqueueMany(moreItems, 3);
+    int sorted[] = { 11, 10, 9, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+    for (int item : sorted)
+        assertEquals(item, built.dequeue());
+
+    PriorityQueue<int> emptyBuilt(items, 0);
+    emptyBuilt.enqueueMany(items, 10);
+    assertEquals(9, emptyBuilt.dequeue());
+    assertEquals(9, emptyBuilt.dequeue());
+    assertEquals(8, emptyBuilt.peek());
+
+    PriorityQueue<string> strings;
+    strings.enqueue("b");
+    strings.enqueue(string("c"));
+    strings.enqueue("a");
+    assertEquals<string>("c", strings.dequeue());
+    assertEquals<string>("b", strings.dequeue());
+    assertEquals<string>("a", strings.dequeue());
+}
+
+
+void statisticalSinkingQueueTest()
+{
+    StatisticalSinkingQueue<int> intWindow(4);
+    int samples[] = { 5, 1, 7, 3, 3, 9, 2 };
+    intWindow.enqueueBulk(samples, 4);
+    assertEquals<long long>(16, intWindow.getSum());
+    assertEquals(4.0, intWindow.mean());
+    assertEquals(5.0, intWindow.variance());
+    assertEquals(1, intWindow.min());
+    assertEquals(7, intWindow.max());
+
+    intWindow.enqueue(3); // 5 is removed
+    assertEquals(1, intWindow.min());
+    intWindow.enqueue(9); // 1 is removed
+    assertEquals(3, intWindow.min());
+    assertEquals(9, intWindow.max());
+    assertEquals(7, intWindow.dequeue());
+    assertEquals(9, intWindow.max());
+    assertEquals(5.0, intWindow.mean());
+    assertEquals(9, intWindow.dequeue(2)); // 3, 3 left
+    assertEquals(3, intWindow.max());
+    intWindow.enqueue(2);
+    assertEquals(3, intWindow.dequeue(0)); // 3, 2 left
+    assertEquals(2, intWindow.peek(1));
+    assertEquals(2, intWindow.min());
+    assertEquals(2.5, intWindow.mean());
+    intWindow.clear();
+    assertEquals(0.0, intWindow.mean());
+    intWindow.enqueue(-2);
+    assertEquals(-2, intWindow.max());
+
+    // samples can be only read (writing would bypass the statistics)
+    static_assert(std::is_same<decltype(intWindow.peek(0)), const int&>::value, "peek() should be read-only");
+    static_assert(std::is_same<decltype(*intWindow.begin()), const int&>::value, "iterators should be read-only");
+    static_assert(!std::is_base_of<IQueue<int>, StatisticalSinkingQueue<int>>::value, "IQueue gives write access");
+    intWindow.enqueue(4);
+    assertEquals(2LL, intWindow.reduce(0LL, [](long long sum, int item) { return sum + item; }));
+    assertEquals<size_t>(2, intWindow.countIf([](int item) { return item != 0; }));
+
+    // squares of 32 and 64 bit samples don't fit in int64_t
+    StatisticalSinkingQueue<int32_t> wideWindow(4);
+    for (int i = 0; i < 4; i++)
+        wideWindow.enqueue(i % 2 == 0 ? 2000000000 : -2000000000);
+    assertEquals(0.0, wideWindow.mean());
+    assertEquals(true, fabs(wideWindow.variance() / 4e18 - 1) < 1e-9);
+    StatisticalSinkingQueue<int64_t> int64Window(3);
+    for (int i = 0; i < 3; i++)
+        int64Window.enqueue(3000000000LL);
+    assertEquals(3e9, int64Window.mean());
+    assertEquals(true, int64Window.variance() < 1);
+
+    // compare with the brute force over the random float samples
+    const size_t WindowSize = 50;
+    StatisticalSinkingQueue<float> floatWindow(WindowSize);
+    vector<float> allSamples;
+    srand(777);
+    for (int i = 0; i < 20000; i++)
+    {
+        float sample = 1000.0f + (rand() % 20001 - 10000) / 1000.0f;
+        allSamples.push_back(sample);
+        floatWindow.enqueue(sample);
+    }
+
+    vector<float> window(allSamples.end() - WindowSize, allSamples.end());
+    double expectedMean = 0;
+    for (float sample : window)
+        expectedMean += sample;
+    expectedMean /= WindowSize;
+    double expectedVariance = 0;
+    for (float sample : window)
+        expectedVariance += (sample - expectedMean) * (sample - expectedMean);
+    expectedVariance /= WindowSize;
+
+    assertEquals(true, fabs(expectedMean - floatWindow.mean()) < 1e-6);
+    assertEquals(true, fabs(expectedVariance - floatWindow.variance()) < 1e-6);
+    assertEquals(*min_element(window.begin(), window.end()), floatWindow.min());
+    assertEquals(*max_element(window.begin(), window.end()), floatWindow.max());
+}
+
+
+void spscQueueTest()
+{
+    SpscQueue<int> singleThreadQueue(5);
+    staticQueueTest(singleThreadQueue, 5);
+
+    SpscQueue<int> emptyQueue(0);
+    assertEquals(false, emptyQueue.enqueue(1));
+
+    // producer and consumer in separate threads
+    const int ItemsAmount = 100000;
+    SpscQueue<int> queue(64);
+
+    thread producer([&queue]() {
+        for (int i = 0; i < ItemsAmount; i++)
+            while (!queue.enqueue(i))
+                this_thread::yield();
+    });
+
+    int nextExpected = 0;
+    bool inOrder = true;
+    int item;
+    while (nextExpected < ItemsAmount)
+    {
+        if (queue.tryDequeue(item))
+            inOrder &= item == nextExpected++;
+        else
+            this_thread::yield();
+    }
+
+    producer.join();
+    assertEquals(true, inOrder);
+    assertEquals(true, queue.isEmpty());
+}
+
+
+
+void mpmcQueueTest()
+{
+    MpmcQueue<int> singleThreadQueue(5);
+    assertEquals<size_t>(8, singleThreadQueue.getCapacity());
+    for (int i = 0; i < 8; i++)
+        assertEquals(true, singleThreadQueue.tryEnqueue(i));
+    assertEquals(false, singleThreadQueue.tryEnqueue(8));
+    assertEquals(true, singleThreadQueue.isFull());
+
+    int item = -1;
+    for (int i = 0; i < 20; i++) // go around the array several times
+    {
+        assertEquals(true, singleThreadQueue.tryDequeue(item));
+        assertEquals(i, item);
+        assertEquals(true, singleThreadQueue.enqueue(i + 8));
+    }
+    assertEquals<size_t>(8, singleThreadQueue.getQueueLength());
+    singleThreadQueue.clear();
+    assertEquals(false, singleThreadQueue.tryDequeue(item));
+
+    // several producers and consumers
+    const int ProducersAmount = 4;
+    const int ConsumersAmount = 2;
+    const int ItemsPerProducer = 20000;
+    MpmcQueue<int> queue(16);
+    atomic<long long> receivedSum{0};
+    atomic<int> receivedAmount{0};
+    atomic<bool> inOrder{true};
+
+    vector<thread> threads;
+    for (int p = 0; p < ProducersAmount; p++)
+        threads.emplace_back([&queue, p]() {
+            for (int i = 0; i < ItemsPerProducer; i++)
+                while (!queue.tryEnqueue(p * ItemsPerProducer + i))
+                    this_thread::yield();
+        });
+
+    for (int c = 0; c < ConsumersAmount; c++)
+        threads.emplace_back([&]() {
+            vector<int> lastFromProducer(ProducersAmount, -1);
+            int item;
+            while (receivedAmount.load() < ProducersAmount * ItemsPerProducer)
+            {
+                if (!queue.tryDequeue(item))
+                {
+                    this_thread::yield();
+                    continue;
+                }
+
+                // items of one producer have to be received in order
+                int producer = item / ItemsPerProducer;
+                if (item <= lastFromProducer[producer])
+                    inOrder = false;
+                lastFromProducer[producer] = item;
+
+                receivedSum += item;
+                receivedAmount++;
+            }
+        });
+
+    for (thread& t : threads)
+        t.join();
+
+    const long long AllItems = ProducersAmount * ItemsPerProducer;
+    assertEquals(AllItems * (AllItems - 1) / 2, receivedSum.load());
+    assertEquals(true, inOrder.load());
+    assertEquals(true, queue.isEmpty());
+}
+
+
+
+void seqlockSinkingQueueTest()
+{
+    SeqlockSinkingQueue<int> singleThreadQueue(4);
+    int output[8];
+    assertEquals<size_t>(0, singleThreadQueue.snapshot(output, 8));
+    for (int i = 0; i < 6; i++)
+        assertEquals(true, singleThreadQueue.enqueue(i));
+    assertEquals<size_t>(4, singleThreadQueue.getQueueLength());
+    assertEquals<size_t>(6, singleThreadQueue.getVersion());
+
+    assertEquals<size_t>(4, singleThreadQueue.snapshot(output, 8));
+    for (int i = 0; i < 4; i++)
+        assertEquals(i + 2, output[i]);
+    assertEquals<size_t>(2, singleThreadQueue.snapshot(output, 2)); // only the newest
+    assertEquals(4, output[0]);
+    assertEquals(5, output[1]);
+
+    singleThreadQueue.clear();
+    assertEquals<size_t>(0, singleThreadQueue.snapshot(output, 8));
+
+    SeqlockSinkingQueue<int> emptyQueue(0);
+    assertEquals(false, emptyQueue.enqueue(1));
+
+    // writer enqueues consecutive numbers, so every consistent snapshot is consecutive
+    const int ItemsAmount = 50000;
+    const size_t WindowSize = 16;
+    SeqlockSinkingQueue<int> queue(WindowSize);
+    atomic<bool> writerFinished{false};
+
+    thread writer([&queue, &writerFinished]() {
+        for (int i = 0; i < ItemsAmount; i++)
+        {
+            queue.enqueue(i);
+            if (i % 64 == 0)
+                this_thread::yield();
+        }
+        writerFinished = true;
+    });
+
+    atomic<bool> consistent{true};
+    auto reader = [&queue, &writerFinished, &consistent]() {
+        int window[WindowSize];
+        while (!writerFinished)
+        {
+            size_t amount = queue.snapshot(window, WindowSize);
+            for (size_t i = 1; i < amount; i++)
+                if (window[i] != window[i - 1] + 1)
+                    consistent = false;
+        }
+    };
+    thread secondReader(reader);
+    reader();
+
+    writer.join();
+    secondReader.join();
+    assertEquals(true, consistent.load());
+    assertEquals<size_t>(8, queue.snapshot(output, 8));
+    assertEquals(ItemsAmount - 1, output[7]);
+
+    // elements bigger than a machine word (every element has to be copied whole)
+    struct Sample { float x, y, z; };
+    SeqlockSinkingQueue<Sample> samples(WindowSize);
+    Sample sampleOutput[WindowSize];
+    assertEquals<size_t>(0, samples.snapshot(sampleOutput, WindowSize));
+    writerFinished = false;
+
+    thread samplesWriter([&samples, &writerFinished]() {
+        for (int i = 0; i < ItemsAmount; i++)
+        {
+            samples.enqueue(Sample{ (float)i, 2.0f * i, 3.0f * i });
+            if (i % 64 == 0)
+                this_thread::yield();
+        }
+        writerFinished = true;
+    });
+
+    auto samplesReader = [&samples, &writerFinished, &consistent]() {
+        Sample window[WindowSize];
+        while (!writerFinished)
+        {
+            size_t amount = samples.snapshot(window, WindowSize);
+            for (size_t i = 0; i < amount; i++)
+                if (window[i].y != 2 * window[i].x || window[i].z != 3 * window[i].x
+                    || (i > 0 && window[i].x != window[i - 1].x + 1))
+                    consistent = false;
+        }
+    };
+    thread secondSamplesReader(samplesReader);
+    samplesReader();
+
+    samplesWriter.join();
+    secondSamplesReader.join();
+    assertEquals(true, consistent.load());
+    assertEquals<size_t>(WindowSize, samples.snapshot(sampleOutput, WindowSize));
+    assertEquals((float)(ItemsAmount - 1), sampleOutput[WindowSize - 1].x);
+    assertEquals(3.0f * (ItemsAmount - 1), sampleOutput[WindowSize - 1].z);
+}
+
+
+void firFilterTest()
+{
+    // integer filter is exact
+    int intCoefficients[] = { 3, 2, 1 };
+    FirFilter<int> intFilter(intCoefficients, 3);
+    assertEquals(3, intFilter.filter(1));
+    assertEquals(2 * 3 + 1 * 2, intFilter.filter(2));
+    assertEquals(5 * 3 + 2 * 2 + 1 * 1, intFilter.filter(5));
+    assertEquals(1 * 3 + 5 * 2 + 2 * 1, intFilter.filter(1));
+    assertEquals(2, intFilter.getWindow()[0]);
+    assertEquals(1, intFilter.getWindow()[2]);
+    intFilter.reset();
+    assertEquals(0, intFilter.getOutput());
+
+    // compare with the scalar loop over the sinking queue (size not divisible by vector width)
+    const size_t WindowSize = 37;
+    float coefficients[WindowSize];
+    for (size_t i = 0; i < WindowSize; i++)
+        coefficients[i] = (float)(i % 5) - 1.5f;
+
+    FirFilter<float> filter(coefficients, WindowSize);
+    StaticSinkingQueue<float> queue(WindowSize);
+    for (size_t i = 0; i < WindowSize; i++)
+        queue.enqueue(0);
+
+    srand(123);
+    for (int n = 0; n < 1000; n++)
+    {
+        float sample = (rand() % 2001 - 1000) / 100.0f;
+        queue.enqueue(sample);
+
+        float expected = 0;
+        for (size_t k = 0; k < WindowSize; k++)
+            expected += coefficients[k] * queue.peek(WindowSize - 1 - k);
+
+        assertEquals(true, fabs(expected - filter.filter(sample)) < 1e-2);
+    }
+
+    FirFilter<float> copied = filter;
+    assertEquals(filter.getOutput(), copied.getOutput());
+
+    FirFilter<double> average(4);
+    average.setMovingAverage();
+    average.filter(1);
+    average.filter(2);
+    average.filter(3);
+    assertEquals(2.5, average.filter(4));
+    assertEquals(3.5, average.filter(5));
+}
+
+
+
+template <class Map>
+void mapTest(Map& map, size_t elementsAmount)
+{
+    assertEquals(true, map.isEmpty());
+    assertEquals(false, map.contains(1));
+    assertEquals(true, map.find(1) == nullptr);
+
+    for (size_t i = 0; i < elementsAmount; i++)
+        assertEquals(true, map.insert((int)i * 3, (int)i));
+    assertEquals(false, map.insert(0, 100)); // already exists
+    assertEquals(0, *map.find(0));
+    assertEquals(elementsAmount, map.size());
+
+    for (size_t i = 0; i < elementsAmount; i++)
+    {
+        assertEquals(true, map.contains((int)i * 3));
+        assertEquals(false, map.contains((int)i * 3 + 1));
+    }
+
+    assertEquals(true, map.set(3, 33));
+    assertEquals(33, *map.find(3));
+    *map.find(3) = 34;
+    assertEquals(34, *map.find(3));
+
+    // remove every second key, the rest have to stay reachable
+    for (size_t i = 0; i < elementsAmount; i += 2)
+        assertEquals(true, map.erase((int)i * 3));
+    assertEquals(false, map.erase(0));
+    assertEquals(elementsAmount / 2, map.size());
+    for (size_t i = 1; i < elementsAmount; i += 2)
+        assertEquals(i == 1 ? 34 : (int)i, *map.find((int)i * 3));
+    for (size_t i = 0; i < elementsAmount; i += 2)
+        assertEquals(false, map.contains((int)i * 3));
+
+    map.clear();
+    assertEquals(true, map.isEmpty());
+    assertEquals(false, map.contains(3));
+    assertEquals(true, map.insert(3, 1));
+}
+
+
+void hashMapTest()
+{
+    HashMap<int, int> map;
+    mapTest(map, 1000);
+    assertEquals(true, map.getCapacity() >= 1000);
+
+    HashMap<int, int> reserved(100);
+    size_t capacity = reserved.getCapacity();
+    assertEquals(true, capacity >= 100);
+    mapTest(reserved, 100);
+    assertEquals(capacity, reserved.getCapacity());
+
+    IMap<int, int>& mapInterface = map;
+    mapInterface.clear();
+    mapTest(mapInterface, 50);
+
+    // compare with std::unordered_map on random operations
+    HashMap<int, int> randomMap;
+    std::unordered_map<int, int> expected;
+    srand(5);
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = rand() % 500;
+        int operation = rand() % 3;
+        if (operation == 0)
+            assertEquals(expected.insert({ key, i }).second, randomMap.insert(key, i));
+        else if (operation == 1)
+            assertEquals(expected.erase(key) == 1, randomMap.erase(key));
+        else
+        {
+            auto found = expected.find(key);
+            const int* value = randomMap.find(key);
+            assertEquals(found != expected.end(), value != nullptr);
+            if (value != nullptr)
+                assertEquals(found->second, *value);
+        }
+    }
+    assertEquals(expected.size(), randomMap.size());
+
+    int sum = 0;
+    randomMap.forEach([&sum](const int& key, int& value) { sum += key; value = 0; });
+    int expectedSum = 0;
+    for (auto& element : expected)
+        expectedSum += element.first;
+    assertEquals(expectedSum, sum);
+
+    // copying and moving
+    HashMap<string, string> strings;
+    strings.set("one", "1");
+    strings.set("two", "2");
+    HashMap<string, string> copied = strings;
+    strings.erase("one");
+    assertEquals<string>("1", *copied.find("one"));
+    HashMap<string, string> moved = std::move(copied);
+    assertEquals<size_t>(2, moved.size());
+    assertEquals<size_t>(0, copied.size());
+    copied = moved;
+    assertEquals<string>("2", *copied.find("two"));
+
+    // insert value of own entry when the table has to grow
+    HashMap<int, string> aliasing;
+    for (int key = 0; aliasing.size() < aliasing.getCapacity() || aliasing.size() == 0; key++)
+        aliasing.insert(key, "value " + to_string(key));
+    size_t fullCapacity = aliasing.getCapacity();
+    assertEquals(true, aliasing.insert(100, *aliasing.find(3)));
+    assertEquals(true, aliasing.getCapacity() > fullCapacity);
+    assertEquals<string>("value 3", *aliasing.find(100));
+    assertEquals(true, aliasing.set(101, *aliasing.find(100)));
+    assertEquals<string>("value 3", *aliasing.find(101));
+}
+
+
+void staticHashMapTest()
+{
+    StaticHashMap<int, int, 100> map;
+    mapTest(map, 100);
+    assertEquals<size_t>(100, map.getCapacity());
+
+    map.clear();
+    for (int i = 0; i < 100; i++)
+        map.insert(i, i);
+    assertEquals(false, map.insert(100, 100)); // full
+    assertEquals(false, map.set(100, 100));
+    assertEquals(true, map.set(5, 50)); // existing key can be changed
+    assertEquals(true, map.erase(7));
+    assertEquals(true, map.insert(100, 100));
+
+    StaticHashMap<int, int, 100> copied = map;
+    assertEquals(50, *copied.find(5));
+    assertEquals(100, *copied.find(100));
+    assertEquals(false, copied.contains(7));
+
+    StaticHashMap<string, int, 4> strings;
+    strings.insert("a", 1);
+    strings.insert("b", 2);
+    StaticHashMap<string, int, 4> stringsCopy;
+    stringsCopy = strings;
+    assertEquals(2, *stringsCopy.find("b"));
+}
+
+
+void flatMapTest()
+{
+    FlatMap<int, int> map;
+    mapTest(map, 300);
+
+    FlatMap<string, int> parameters;
+    FlatMap<string, int>::Entry defaults[] = { { "rate", 400 }, { "gain", 2 }, { "limit", 10 }, { "gain", 3 } };
+    parameters.set("limit", 20);
+    parameters.insertMany(defaults, 4);
+    assertEquals<size_t>(3, parameters.size());
+    assertEquals(20, *parameters.find("limit")); // existing key is not changed
+    assertEquals(2, *parameters.find("gain")); // first of the duplicated keys
+    assertEquals<string>("gain", parameters.getEntry(0).key);
+    assertEquals<string>("rate", parameters.getEntry(2).key);
+    assertEquals<size_t>(1, parameters.lowerBound("limit"));
+    assertEquals<size_t>(2, parameters.upperBound("limit"));
+    assertEquals(true, parameters.find("x") == nullptr);
+
+    FlatMap<int, int, std::greater<int>> descending;
+    FlatMap<int, int, std::greater<int>>::Entry entries[] = { { 1, 1 }, { 3, 3 }, { 2, 2 } };
+    descending.insertMany(entries, 3);
+    assertEquals(3, descending.getEntry(0).key);
+    assertEquals(1, descending.getEntry(2).key);
+    assertEquals(2, *descending.find(2));
+
+    // values don't have to be comparable
+    struct Point { int x, y; };
+    FlatMap<int, Point> points;
+    FlatMap<int, Point>::Entry newPoints[] = { { 2, { 2, 4 } }, { 1, { 1, 2 } }, { 2, { 0, 0 } } };
+    points.insertMany(newPoints, 3);
+    assertEquals<size_t>(2, points.size());
+    assertEquals(4, points.find(2)->y);
+}
+
+
+
+void sortedArrayTest()
+{
+    SortedArray<int> array;
+    int items[] = { 5, 1, 9, 3, 7, 3 };
+    for (int item : items)
+        assertEquals(true, array.add(item));
+    int expected[] = { 1, 3, 3, 5, 7, 9 };
+    for (size_t i = 0; i < 6; i++)
+        assertEquals(expected[i], array[i]);
+
+    assertEquals<size_t>(1, array.lowerBound(3));
+    assertEquals<size_t>(3, array.upperBound(3));
+    assertEquals<size_t>(1, array.find(3));
+    assertEquals(npos, array.find(4));
+    assertEquals<size_t>(6, array.lowerBound(10));
+    assertEquals(true, array.contains(9));
+
+    // merge many elements (including equal ones and ones before/after all others)
+    int newItems[] = { 8, 0, 3, 10, 6, 2 };
+    array.insertMany(newItems, 6);
+    int merged[] = { 0, 1, 2, 3, 3, 3, 5, 6, 7, 8, 9, 10 };
+    assertEquals<size_t>(12, array.size());
+    for (size_t i = 0; i < 12; i++)
+        assertEquals(merged[i], array.get(i));
+
+    assertEquals(true, array.removeItem(3));
+    assertEquals(false, array.removeItem(4));
+    assertEquals(true, array.remove(0));
+    assertEquals(1, array[0]);
+    assertEquals<size_t>(10, array.size());
+
+    // insertMany into the empty array and comparing with std::sort
+    SortedArray<int, std::greater<int>> descending;
+    vector<int> randomItems;
+    srand(11);
+    for (int i = 0; i < 200; i++)
+        randomItems.push_back(rand() % 50);
+    descending.insertMany(randomItems.data(), 100);
+    descending.insertMany(randomItems.data() + 100, 100);
+    sort(randomItems.begin(), randomItems.end(), std::greater<int>());
+    for (size_t i = 0; i < 200; i++)
+        assertEquals(randomItems[i], descending[i]);
+
+    SortedArray<string> strings;
+    string stringItems[] = { "b", "c", "a" };
+    strings.insertMany(stringItems, 3);
+    strings.add("bb");
+    assertEquals<string>("a", strings[0]);
+    assertEquals<string>("bb", strings[2]);
+    strings.clear();
+    assertEquals(true, strings.isEmpty());
+}
+
+
+
+void stlIteratorsTest()
+{
+    GrowingArray<int> array;
+    int items[] = { 5, 1, 4, 2, 3 };
+    for (int item : items)
+        array.add(item);
+
+    int sum = 0;
+    for (int& item : array)
+        sum += item;
+    assertEquals(15, sum);
+    sort(array.begin(), array.end());
+    assertEquals(1, array[0]);
+    assertEquals(5, array[4]);
+    const GrowingArray<int>& constArray = array;
+    assertEquals(15, accumulate(constArray.begin(), constArray.end(), 0));
+    GrowingArray<int> emptyArray;
+    assertEquals(true, emptyArray.begin() == emptyArray.end());
+
+    LinkedList<int> list;
+    for (int item : items)
+        list.add(item);
+    sum = 0;
+    for (int item : list)
+        sum += item;
+    assertEquals(15, sum);
+    for (int& item : list)
+        item *= 2;
+    const LinkedList<int>& constList = list;
+    assertEquals(10, *max_element(constList.begin(), constList.end()));
+    assertEquals<ptrdiff_t>(2, distance(list.begin(), find(list.begin(), list.end(), 8)));
+    LinkedList<int> emptyList;
+    assertEquals<ptrdiff_t>(0, distance(emptyList.begin(), emptyList.end()));
+
+    // mutable iterators are converted to const ones (and can be compared with them)
+    NodeWalker<const int, const Node<int>> constListIterator = list.begin();
+    assertEquals(true, constListIterator == list.begin());
+    assertEquals(true, list.begin() == constListIterator);
+    assertEquals(true, list.end() != constListIterator);
+    assertEquals(2, *++constListIterator);
+
+    // queue with elements wrapped around the array end
+    StaticQueue<int> queue(5);
+    for (int i = 0; i < 3; i++)
+    {
+        queue.enqueue(0);
+        queue.dequeue();
+    }
+    for (int item : items)
+        queue.enqueue(item);
+    int expectedOrder[] = { 5, 1, 4, 2, 3 };
+    size_t index = 0;
+    for (int item : queue)
+        assertEquals(expectedOrder[index++], item);
+    assertEquals<size_t>(5, index);
+    assertEquals<ptrdiff_t>(5, queue.end() - queue.begin());
+    assertEquals(4, queue.begin()[2]);
+    RingIterator<const int> constQueueIterator = queue.begin() + 1;
+    assertEquals(1, *constQueueIterator);
+    assertEquals<ptrdiff_t>(4, queue.end() - constQueueIterator);
+    assertEquals<ptrdiff_t>(-1, queue.begin() - constQueueIterator);
+    assertEquals(true, queue.begin() < constQueueIterator);
+    assertEquals(true, constQueueIterator >= queue.begin());
+    static_assert(!std::is_convertible<RingIterator<const int>, RingIterator<int>>::value, "const iterator can't become mutable");
+    static_assert(!std::is_convertible<NodeWalker<const int, const Node<int>>, NodeWalker<int, Node<int>>>::value, "const iterator can't become mutable");
+    sort(queue.begin(), queue.end());
+    for (int i = 1; i <= 5; i++)
+        assertEquals(i, queue.dequeue());
+
+    StaticQueue<int, 4> compileTimeQueue;
+    compileTimeQueue.enqueue(1);
+    compileTimeQueue.enqueue(2);
+    const StaticQueue<int, 4>& constQueue = compileTimeQueue;
+    assertEquals(3, accumulate(constQueue.begin(), constQueue.end(), 0));
+    reverse(compileTimeQueue.begin(), compileTimeQueue.end());
+    assertEquals(2, compileTimeQueue.peek());
+
+    StaticSinkingQueue<int> sinkingQueue(3);
+    for (int item : items)
+        sinkingQueue.enqueue(item);
+    vector<int> copied(sinkingQueue.begin(), sinkingQueue.end());
+    assertEquals<size_t>(3, copied.size());
+    assertEquals(4, copied[0]);
+    assertEquals(3, copied[2]);
+}
+
+
+
+void internalIterationTest()
+{
+    auto isEven = [](int item) { return item % 2 == 0; };
+    auto add = [](long long sum, int item) { return sum + item; };
+
+    GrowingArray<int> array;
+    for (int i = 1; i <= 100; i++)
+        array.add(i);
+    assertEquals(5050LL, array.reduce(0LL, add));
+    assertEquals<size_t>(50, array.countIf(isEven));
+    array.transformInPlace([](int item) { return item * 3; });
+    assertEquals(300, array[99]);
+    int visited = 0;
+    const GrowingArray<int>& constArray = array;
+    constArray.forEach([&visited](const int& item) { visited += item; });
+    assertEquals(15150, visited);
+    assertEquals(7, GrowingArray<int>().reduce(7, add));
+
+    LinkedList<int> list;
+    for (int i = 1; i <= 10; i++)
+        list.add(i);
+    assertEquals(55LL, list.reduce(0LL, add));
+    assertEquals<size_t>(5, list.countIf(isEven));
+    list.transformInPlace([](int item) { return -item; });
+    assertEquals(-10, list[9]);
+    list.forEach([](int& item) { item += 10; });
+    assertEquals(9, list[0]);
+    int previous = 0;
+    bool ordered = true;
+    list.forEach([&](int item) { ordered = ordered && item < previous + 10; previous = item; });
+    assertEquals(true, ordered);
+
+    // elements wrapped around the array end
+    StaticQueue<int> queue(5);
+    for (int i = 0; i < 3; i++)
+    {
+        queue.enqueue(0);
+        queue.dequeue();
+    }
+    for (int i = 1; i <= 5; i++)
+        queue.enqueue(i);
+    assertEquals(15LL, queue.reduce(0LL, add));
+    assertEquals<size_t>(2, queue.countIf(isEven));
+    queue.transformInPlace([](int item) { return item * 10; });
+    vector<int> order;
+    queue.forEach([&order](int item) { order.push_back(item); });
+    assertEquals<size_t>(5, order.size());
+    for (int i = 0; i < 5; i++)
+        assertEquals((i + 1) * 10, order[i]);
+    assertEquals(10, queue.peek());
+
+    StaticQueue<int, 4> compileTimeQueue;
+    compileTimeQueue.enqueue(3);
+    compileTimeQueue.dequeue();
+    compileTimeQueue.enqueue(4);
+    compileTimeQueue.enqueue(5);
+    compileTimeQueue.enqueue(6);
+    compileTimeQueue.enqueue(7);
+    assertEquals(22LL, compileTimeQueue.reduce(0LL, add));
+    assertEquals<size_t>(2, compileTimeQueue.countIf(isEven));
+
+    StatisticalSinkingQueue<int> statisticalQueue(3);
+    for (int i = 1; i <= 5; i++)
+        statisticalQueue.enqueue(i);
+    assertEquals(12LL, statisticalQueue.reduce(0LL, add));
+
+    GrowingQueue<int> growingQueue(2);
+    for (int i = 1; i <= 6; i++)
+        growingQueue.enqueue(i);
+    growingQueue.dequeue();
+    growingQueue.enqueueFront(100);
+    assertEquals(120LL, growingQueue.reduce(0LL, add));
+    growingQueue.transformInPlace([](int item) { return item + 1; });
+    assertEquals(101, growingQueue.peek());
+    assertEquals(7, growingQueue.peekBack());
+    assertEquals<size_t>(2, growingQueue.countIf(isEven));
+    assertEquals<size_t>(0, GrowingQueue<int>(0).countIf(isEven));
+
+    int items[] = { 7, 3, 9, 1, 4 };
+    PriorityQueue<int> priorityQueue(items, 5);
+    assertEquals(24LL, priorityQueue.reduce(0LL, add));
+    assertEquals<size_t>(1, priorityQueue.countIf(isEven));
+    int maximum = 0;
+    priorityQueue.forEach([&maximum](int item) { maximum = item > maximum ? item : maximum; });
+    assertEquals(9, maximum);
+}